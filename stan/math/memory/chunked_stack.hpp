@@ -0,0 +1,281 @@
+#ifndef STAN_MATH_MEMORY_CHUNKED_STACK_HPP
+#define STAN_MATH_MEMORY_CHUNKED_STACK_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * A stack of trivially copyable values, such as pointers, stored in
+ * fixed size chunks of memory.
+ *
+ * Unlike <code>std::vector</code>, growing the stack never moves the
+ * entries already pushed: when the current chunk is full, the next
+ * chunk is used, allocating it if necessary. Chunks are kept when the
+ * stack shrinks, so after the first use of a given depth pushing
+ * entries does not allocate memory. All chunks are freed by the
+ * destructor.
+ *
+ * As all chunks have the same power of two size, random access is a
+ * shift and a mask, and the entries can be traversed chunk by chunk
+ * with <code>for_each()</code> and <code>for_each_reverse()</code>,
+ * which run a plain pointer loop over each chunk.
+ *
+ * @tparam T type of the entries
+ */
+template <typename T>
+class chunked_stack {
+ public:
+  static constexpr size_t log2_chunk_size = 14;
+  static constexpr size_t chunk_size = size_t(1) << log2_chunk_size;
+
+ private:
+  std::vector<T*> chunks_;  // allocated chunks, may be more than used
+  size_t used_chunks_;      // number of chunks holding entries
+  T* top_;                  // next free entry in the current chunk
+  T* top_end_;              // end of the current chunk
+  size_t high_water_mark_;  // largest size when the stack was shrunk
+
+  /**
+   * Move to the next chunk, allocating it if necessary. Called when
+   * the current chunk is full.
+   */
+  void next_chunk() {
+    if (used_chunks_ == chunks_.size()) {
+      T* chunk = static_cast<T*>(malloc(chunk_size * sizeof(T)));
+      if (!chunk) {
+        throw std::bad_alloc();
+      }
+      chunks_.push_back(chunk);
+    }
+    top_ = chunks_[used_chunks_];
+    top_end_ = top_ + chunk_size;
+    ++used_chunks_;
+  }
+
+ public:
+  /**
+   * Construct an empty stack. No memory is allocated until the first
+   * entry is pushed.
+   */
+  chunked_stack()
+      : used_chunks_(0),
+        top_(nullptr),
+        top_end_(nullptr),
+        high_water_mark_(0) {}
+
+  chunked_stack(const chunked_stack&) = delete;
+  chunked_stack& operator=(const chunked_stack&) = delete;
+
+  /**
+   * Free all chunks.
+   */
+  ~chunked_stack() {
+    for (auto& chunk : chunks_) {
+      free(chunk);
+    }
+  }
+
+  /**
+   * Push an entry on top of the stack.
+   *
+   * @param x entry
+   * @throw std::bad_alloc if a new chunk cannot be allocated
+   */
+  inline void push_back(const T& x) {
+    if (unlikely(top_ == top_end_)) {
+      next_chunk();
+    }
+    *top_++ = x;
+  }
+
+  /**
+   * @return number of entries on the stack
+   */
+  inline size_t size() const {
+    return used_chunks_ == 0
+               ? 0
+               : (used_chunks_ - 1) * chunk_size
+                     + (top_ - chunks_[used_chunks_ - 1]);
+  }
+
+  /**
+   * @return true if there are no entries on the stack
+   */
+  inline bool empty() const { return size() == 0; }
+
+  /**
+   * Return the entry with the specified index, counted from the
+   * bottom of the stack.
+   *
+   * @param i index
+   * @return entry
+   */
+  inline T& operator[](size_t i) {
+    return chunks_[i >> log2_chunk_size][i & (chunk_size - 1)];
+  }
+
+  /**
+   * Return the entry with the specified index, counted from the
+   * bottom of the stack.
+   *
+   * @param i index
+   * @return entry
+   */
+  inline const T& operator[](size_t i) const {
+    return chunks_[i >> log2_chunk_size][i & (chunk_size - 1)];
+  }
+
+  /**
+   * @return entry on top of the stack, which must not be empty
+   */
+  inline T& back() { return *(top_ - 1); }
+
+  /**
+   * Shrink the stack to the specified number of entries. The memory
+   * of the chunks which are no longer used is kept for reuse. The
+   * number of entries before shrinking is recorded for
+   * <code>high_water_mark()</code>.
+   *
+   * @param n new number of entries, not greater than the current
+   * number of entries
+   */
+  inline void resize(size_t n) {
+    high_water_mark_ = std::max(high_water_mark_, size());
+    if (n == 0) {
+      used_chunks_ = 0;
+      top_ = nullptr;
+      top_end_ = nullptr;
+      return;
+    }
+    used_chunks_ = ((n - 1) >> log2_chunk_size) + 1;
+    T* chunk = chunks_[used_chunks_ - 1];
+    top_ = chunk + (n - (used_chunks_ - 1) * chunk_size);
+    top_end_ = chunk + chunk_size;
+  }
+
+  /**
+   * Remove all entries from the stack, keeping the memory of the
+   * chunks for reuse.
+   */
+  inline void clear() { resize(0); }
+
+  /**
+   * Return the largest number of entries when the stack was shrunk
+   * with <code>resize()</code> or <code>clear()</code>.
+   *
+   * @return high-water mark in number of entries
+   */
+  inline size_t high_water_mark() const { return high_water_mark_; }
+
+  /**
+   * @return number of entries which fit into the allocated chunks
+   */
+  inline size_t capacity() const { return chunks_.size() * chunk_size; }
+
+  /**
+   * Allocate chunks for at least the specified number of entries, so
+   * that pushing up to that many entries does not allocate memory.
+   *
+   * @param n number of entries
+   * @throw std::bad_alloc if a chunk cannot be allocated
+   */
+  inline void reserve(size_t n) {
+    while (capacity() < n) {
+      T* chunk = static_cast<T*>(malloc(chunk_size * sizeof(T)));
+      if (!chunk) {
+        throw std::bad_alloc();
+      }
+      chunks_.push_back(chunk);
+    }
+  }
+
+  /**
+   * @return number of bytes of memory held by the chunks
+   */
+  inline size_t bytes_allocated() const {
+    return chunks_.size() * chunk_size * sizeof(T);
+  }
+
+  /**
+   * Apply a functor to the entries with indices in
+   * <code>[begin, end)</code>, from the bottom towards the top of the
+   * stack.
+   *
+   * @tparam F type of the functor
+   * @param begin index of the first entry
+   * @param end index one past the last entry
+   * @param f functor called with each entry
+   */
+  template <typename F>
+  inline void for_each(size_t begin, size_t end, F&& f) {
+    while (begin < end) {
+      const size_t chunk = begin >> log2_chunk_size;
+      const size_t chunk_start = chunk << log2_chunk_size;
+      const size_t chunk_end = std::min(end, chunk_start + chunk_size);
+      T* data = chunks_[chunk] + (begin - chunk_start);
+      T* data_end = chunks_[chunk] + (chunk_end - chunk_start);
+      for (; data != data_end; ++data) {
+        f(*data);
+      }
+      begin = chunk_end;
+    }
+  }
+
+  /**
+   * Apply a functor to all entries, from the bottom towards the top
+   * of the stack.
+   *
+   * @tparam F type of the functor
+   * @param f functor called with each entry
+   */
+  template <typename F>
+  inline void for_each(F&& f) {
+    for_each(0, size(), f);
+  }
+
+  /**
+   * Apply a functor to the entries with indices in
+   * <code>[begin, end)</code>, from the top towards the bottom of the
+   * stack.
+   *
+   * The functor may push entries on the stack, as long as it removes
+   * them again before returning. Entries are never moved, so this
+   * does not invalidate the traversal.
+   *
+   * @tparam F type of the functor
+   * @param begin index of the last entry visited
+   * @param end index one past the first entry visited
+   * @param f functor called with each entry
+   */
+  template <typename F>
+  inline void for_each_reverse(size_t begin, size_t end, F&& f) {
+    while (end > begin) {
+      const size_t chunk = (end - 1) >> log2_chunk_size;
+      const size_t chunk_start = chunk << log2_chunk_size;
+      const size_t chunk_begin = std::max(begin, chunk_start);
+      T* data = chunks_[chunk] + (end - chunk_start);
+      T* data_begin = chunks_[chunk] + (chunk_begin - chunk_start);
+      while (data != data_begin) {
+        f(*--data);
+      }
+      end = chunk_begin;
+    }
+  }
+};
+
+template <typename T>
+constexpr size_t chunked_stack<T>::log2_chunk_size;
+
+template <typename T>
+constexpr size_t chunked_stack<T>::chunk_size;
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -5,6 +5,9 @@
 //            is best we can do to get safe pointer casts to uints.
 #include <stdint.h>
 #include <stan/math/prim/meta.hpp>
+#if defined(STAN_MEMORY_HUGEPAGES) && defined(__linux__)
+#include <sys/mman.h>
+#endif
 #include <cstdlib>
 #include <cstddef>
 #include <sstream>
@@ -48,6 +51,45 @@ inline char* eight_byte_aligned_malloc(size_t size) {
   }
   return ptr;
 }
+
+/**
+ * Allocate a single large block of memory for a reserved arena. If
+ * STAN_MEMORY_HUGEPAGES is defined on Linux, the block is an anonymous
+ * memory mapping which the kernel is advised to back with transparent
+ * huge pages; otherwise it is allocated with malloc.
+ *
+ * @param size number of bytes
+ * @return pointer to the block, or nullptr if the allocation failed
+ */
+inline char* reserved_block_alloc(size_t size) {
+#if defined(STAN_MEMORY_HUGEPAGES) && defined(__linux__)
+  void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) {
+    return nullptr;
+  }
+#ifdef MADV_HUGEPAGE
+  madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+  return static_cast<char*>(ptr);
+#else
+  return eight_byte_aligned_malloc(size);
+#endif
+}
+
+/**
+ * Free a block allocated with <code>reserved_block_alloc()</code>.
+ *
+ * @param ptr pointer to the block
+ * @param size number of bytes of the block
+ */
+inline void reserved_block_free(char* ptr, size_t size) {
+#if defined(STAN_MEMORY_HUGEPAGES) && defined(__linux__)
+  munmap(ptr, size);
+#else
+  free(ptr);
+#endif
+}
 }  // namespace internal
 
 /**
@@ -64,6 +106,12 @@ inline char* eight_byte_aligned_malloc(size_t size) {
  * recovered, with the blocks being reused, or all blocks may be
  * freed, resetting the stack of blocks to its original state.
  *
+ * The number of bytes in use when the memory is recovered is recorded,
+ * and <code>reserve()</code> can replace the blocks by a single block
+ * of that size before the next use, so that later uses neither
+ * allocate nor leave the first block. With STAN_MEMORY_HUGEPAGES
+ * defined, the reserved block is mapped with huge pages on Linux.
+ *
  * Alignment up to 8 byte boundaries guaranteed for the first malloc,
  * and after that it's up to the caller.  On 64-bit architectures,
  * all struct values should be padded to 8-byte boundaries if they
@@ -78,6 +126,8 @@ class stack_alloc {
   char* cur_block_end_;        // ptr to cur_block_ptr_ + sizes_[cur_block_]
   char* next_loc_;             // ptr to next available spot in cur
                                // block
+  size_t high_water_mark_;     // max bytes in use when recovering
+  char* reserved_block_;       // block allocated by reserve(), if any
   // next three for keeping track of nested allocations on top of stack:
   std::vector<size_t> nested_cur_blocks_;
   std::vector<char*> nested_next_locs_;
@@ -118,6 +168,34 @@ class stack_alloc {
     return result;
   }
 
+  /**
+   * Record the number of bytes in use if it exceeds the high-water
+   * mark.
+   */
+  inline void update_high_water_mark() {
+    size_t in_use = bytes_in_use();
+    if (in_use > high_water_mark_) {
+      high_water_mark_ = in_use;
+    }
+  }
+
+  /**
+   * Free the block with the specified index.
+   *
+   * @param i index of the block
+   */
+  inline void free_block(size_t i) {
+    if (!blocks_[i]) {
+      return;
+    }
+    if (blocks_[i] == reserved_block_) {
+      internal::reserved_block_free(blocks_[i], sizes_[i]);
+      reserved_block_ = nullptr;
+    } else {
+      free(blocks_[i]);
+    }
+  }
+
  public:
   /**
    * Construct a resizable stack allocator initially holding the
@@ -133,7 +211,9 @@ class stack_alloc {
         sizes_(1, initial_nbytes),
         cur_block_(0),
         cur_block_end_(blocks_[0] + initial_nbytes),
-        next_loc_(blocks_[0]) {
+        next_loc_(blocks_[0]),
+        high_water_mark_(0),
+        reserved_block_(nullptr) {
     if (!blocks_[0]) {
       throw std::bad_alloc();  // no msg allowed in bad_alloc ctor
     }
@@ -147,10 +227,8 @@ class stack_alloc {
    */
   ~stack_alloc() {
     // free ALL blocks
-    for (auto& block : blocks_) {
-      if (block) {
-        free(block);
-      }
+    for (size_t i = 0; i < blocks_.size(); ++i) {
+      free_block(i);
     }
   }
 
@@ -197,6 +275,7 @@ class stack_alloc {
    * function free_all().
    */
   inline void recover_all() {
+    update_high_water_mark();
     cur_block_ = 0;
     next_loc_ = blocks_[0];
     cur_block_end_ = next_loc_ + sizes_[0];
@@ -219,6 +298,7 @@ class stack_alloc {
     if (unlikely(nested_cur_blocks_.empty())) {
       recover_all();
     }
+    update_high_water_mark();
 
     cur_block_ = nested_cur_blocks_.back();
     nested_cur_blocks_.pop_back();
@@ -238,9 +318,7 @@ class stack_alloc {
   inline void free_all() {
     // frees all BUT the first (index 0) block
     for (size_t i = 1; i < blocks_.size(); ++i) {
-      if (blocks_[i]) {
-        free(blocks_[i]);
-      }
+      free_block(i);
     }
     sizes_.resize(1);
     blocks_.resize(1);
@@ -265,6 +343,71 @@ class stack_alloc {
     return sum;
   }
 
+  /**
+   * Return the number of bytes currently in use, including the unused
+   * ends of blocks which have been left for the next block. A single
+   * block of this size is large enough for the same sequence of
+   * allocations.
+   *
+   * @return number of bytes in use
+   */
+  inline size_t bytes_in_use() const {
+    size_t sum = next_loc_ - blocks_[cur_block_];
+    for (size_t i = 0; i < cur_block_; ++i) {
+      sum += sizes_[i];
+    }
+    return sum;
+  }
+
+  /**
+   * Return the largest number of bytes in use when memory was
+   * recovered with <code>recover_all()</code> or
+   * <code>recover_nested()</code>.
+   *
+   * @return high-water mark in bytes
+   */
+  inline size_t high_water_mark() const { return high_water_mark_; }
+
+  /**
+   * Replace the blocks of memory by a single block of at least the
+   * specified number of bytes, so that allocations of up to that many
+   * bytes in total stay within the first block.
+   *
+   * The blocks are only replaced if no memory is in use and the first
+   * block is smaller than the requested size; otherwise this is a
+   * no-op. With STAN_MEMORY_HUGEPAGES defined on Linux, the block is
+   * mapped with transparent huge pages.
+   *
+   * @param nbytes number of bytes to reserve
+   * @return true if the requested number of bytes is available in the
+   * first block after the call
+   * @throw std::bad_alloc if the block cannot be allocated
+   */
+  inline bool reserve(size_t nbytes) {
+    if (nbytes <= sizes_[0]) {
+      return true;
+    }
+    if (cur_block_ != 0 || next_loc_ != blocks_[0]
+        || !nested_cur_blocks_.empty()) {
+      return false;
+    }
+    char* block = internal::reserved_block_alloc(nbytes);
+    if (!block) {
+      throw std::bad_alloc();
+    }
+    for (size_t i = 0; i < blocks_.size(); ++i) {
+      free_block(i);
+    }
+    blocks_.assign(1, block);
+    sizes_.assign(1, nbytes);
+    reserved_block_ = block;
+    // nothing is in use, so the high-water mark is left unchanged
+    cur_block_ = 0;
+    next_loc_ = block;
+    cur_block_end_ = block + nbytes;
+    return true;
+  }
+
   /**
    * Indicates whether the memory in the pointer
    * is in the stack.
@@ -9,6 +9,48 @@
 namespace stan {
 namespace math {
 
+namespace internal {
+/**
+ * Compute the rows of the Hessian in <code>[start, end)</code> and the
+ * matching entries of the gradient, each with one evaluation of the
+ * function with a forward mode tangent and a nested reverse sweep.
+ * The value of the function is stored if the first row is computed.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[in] start first row to compute
+ * @param[in] end one past the last row to compute
+ * @param[out] fx Function applied to argument
+ * @param[out] grad gradient of function at argument
+ * @param[out] H Hessian of function at argument
+ */
+template <typename F>
+void hessian_rows(const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+                  int start, int end, double& fx,
+                  Eigen::Matrix<double, Eigen::Dynamic, 1>& grad,
+                  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& H) {
+  Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1> x_fvar(x.size());
+  for (int i = start; i < end; ++i) {
+    // Run nested autodiff in this scope
+    nested_rev_autodiff nested;
+
+    for (int j = 0; j < x.size(); ++j) {
+      x_fvar(j) = fvar<var>(x(j), i == j);
+    }
+    fvar<var> fx_fvar = f(x_fvar);
+    grad(i) = fx_fvar.d_.val();
+    if (i == 0) {
+      fx = fx_fvar.val_.val();
+    }
+    stan::math::grad(fx_fvar.d_.vi_);
+    for (int j = 0; j < x.size(); ++j) {
+      H(i, j) = x_fvar(j).val_.adj();
+    }
+  }
+}
+}  // namespace internal
+
 /**
  * Calculate the value, the gradient, and the Hessian,
  * of the specified function at the specified argument in
@@ -31,6 +73,11 @@ namespace math {
  * general namespace imports that eventually depend on functions
  * defined in Stan.
  *
+ * Each row of the Hessian requires one evaluation of the function
+ * with a forward mode tangent in the direction of one argument,
+ * followed by a reverse sweep. See <code>hessian_parallel()</code>
+ * to compute the rows concurrently.
+ *
  * @tparam F Type of function
  * @param[in] f Function
  * @param[in] x Argument to function
@@ -50,24 +97,7 @@ void hessian(const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
     fx = f(x);
     return;
   }
-  for (int i = 0; i < x.size(); ++i) {
-    // Run nested autodiff in this scope
-    nested_rev_autodiff nested;
-
-    Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1> x_fvar(x.size());
-    for (int j = 0; j < x.size(); ++j) {
-      x_fvar(j) = fvar<var>(x(j), i == j);
-    }
-    fvar<var> fx_fvar = f(x_fvar);
-    grad(i) = fx_fvar.d_.val();
-    if (i == 0) {
-      fx = fx_fvar.val_.val();
-    }
-    stan::math::grad(fx_fvar.d_.vi_);
-    for (int j = 0; j < x.size(); ++j) {
-      H(i, j) = x_fvar(j).val_.adj();
-    }
-  }
+  internal::hessian_rows(f, x, 0, x.size(), fx, grad, H);
 }
 
 }  // namespace math
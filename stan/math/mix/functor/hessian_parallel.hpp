@@ -0,0 +1,59 @@
+#ifndef STAN_MATH_MIX_FUNCTOR_HESSIAN_PARALLEL_HPP
+#define STAN_MATH_MIX_FUNCTOR_HESSIAN_PARALLEL_HPP
+
+#include <stan/math/fwd/core.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/mix/functor/hessian.hpp>
+
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+namespace stan {
+namespace math {
+
+/**
+ * Calculate the value, the gradient, and the Hessian of the specified
+ * function at the specified argument, as <code>hessian()</code> does,
+ * but computing the rows of the Hessian concurrently.
+ *
+ * If STAN_THREADS is defined, the rows are computed as TBB tasks, each
+ * with its own nested autodiff tape. The functor is then called
+ * concurrently from several threads and must be safe to do so, e.g.
+ * it must not modify shared state. Without STAN_THREADS the autodiff
+ * stack is not thread local and the rows are computed sequentially.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[out] fx Function applied to argument
+ * @param[out] grad gradient of function at argument
+ * @param[out] H Hessian of function at argument
+ */
+template <typename F>
+void hessian_parallel(
+    const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x, double& fx,
+    Eigen::Matrix<double, Eigen::Dynamic, 1>& grad,
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& H) {
+  H.resize(x.size(), x.size());
+  grad.resize(x.size());
+
+  // need to compute fx even with size = 0
+  if (x.size() == 0) {
+    fx = f(x);
+    return;
+  }
+#ifdef STAN_THREADS
+  tbb::parallel_for(tbb::blocked_range<int>(0, x.size()),
+                    [&](const tbb::blocked_range<int>& r) {
+                      internal::hessian_rows(f, x, r.begin(), r.end(), fx,
+                                             grad, H);
+                    });
+#else
+  internal::hessian_rows(f, x, 0, x.size(), fx, grad, H);
+#endif
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
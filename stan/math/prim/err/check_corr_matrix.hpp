@@ -3,9 +3,13 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err/throw_domain_error.hpp>
+#include <stan/math/prim/err/check_ldlt_factor.hpp>
 #include <stan/math/prim/err/check_pos_definite.hpp>
 #include <stan/math/prim/err/check_square.hpp>
+#include <stan/math/prim/err/check_symmetric.hpp>
+#include <stan/math/prim/err/constraint_tolerance.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/LDLT_factor.hpp>
 #include <sstream>
 #include <string>
 #include <cmath>
@@ -13,6 +17,39 @@
 namespace stan {
 namespace math {
 
+namespace internal {
+/**
+ * Check that the diagonal of the specified square matrix is near 1.
+ *
+ * @tparam T_y Type of scalar
+ * @param function Name of the function this was called from
+ * @param name Name of the variable
+ * @param y Matrix to test
+ * @throw <code>std::domain_error</code> if any diagonal element is not
+ *   near 1
+ */
+template <typename T_y>
+inline void check_unit_diagonal(
+    const char* function, const char* name,
+    const Eigen::Matrix<T_y, Eigen::Dynamic, Eigen::Dynamic>& y) {
+  using size_type
+      = index_type_t<Eigen::Matrix<T_y, Eigen::Dynamic, Eigen::Dynamic>>;
+  using std::fabs;
+
+  for (size_type k = 0; k < y.rows(); ++k) {
+    if (!(fabs(y(k, k) - 1.0) <= CONSTRAINT_TOLERANCE)) {
+      std::ostringstream msg;
+      msg << "is not a valid correlation matrix. " << name << "("
+          << stan::error_index::value + k << "," << stan::error_index::value + k
+          << ") is ";
+      std::string msg_str(msg.str());
+      throw_domain_error(function, name, y(k, k), msg_str.c_str(),
+                         ", but should be near 1.0");
+    }
+  }
+}
+}  // namespace internal
+
 /**
  * Check if the specified matrix is a valid correlation matrix.
  * A valid correlation matrix is symmetric, has a unit diagonal
@@ -33,29 +70,48 @@ template <typename T_y>
 inline void check_corr_matrix(
     const char* function, const char* name,
     const Eigen::Matrix<T_y, Eigen::Dynamic, Eigen::Dynamic>& y) {
-  using size_type
-      = index_type_t<Eigen::Matrix<T_y, Eigen::Dynamic, Eigen::Dynamic>>;
-
   check_square(function, name, y);
-  using std::fabs;
   if (y.size() == 0) {
     return;
   }
 
-  for (size_type k = 0; k < y.rows(); ++k) {
-    if (!(fabs(y(k, k) - 1.0) <= CONSTRAINT_TOLERANCE)) {
-      std::ostringstream msg;
-      msg << "is not a valid correlation matrix. " << name << "("
-          << stan::error_index::value + k << "," << stan::error_index::value + k
-          << ") is ";
-      std::string msg_str(msg.str());
-      throw_domain_error(function, name, y(k, k), msg_str.c_str(),
-                         ", but should be near 1.0");
-    }
-  }
+  internal::check_unit_diagonal(function, name, y);
   check_pos_definite(function, "y", y);
 }
 
+/**
+ * Check if the specified matrix is a valid correlation matrix, reading
+ * positive definiteness from an LDLT factor of the matrix instead of
+ * factoring it again. Callers that need the factor anyway, for the log
+ * determinant or for solves, should compute it once and check it with
+ * this function.
+ * @tparam T_y Type of scalar
+ * @tparam R number of rows or Eigen::Dynamic
+ * @tparam C number of columns or Eigen::Dynamic
+ * @param function Name of the function this was called from
+ * @param name Name of the variable
+ * @param y Matrix to test
+ * @param ldlt_y LDLT factor of y
+ * @throw <code>std::invalid_argument</code> if the matrix is not square
+ * @throw <code>std::domain_error</code> if the matrix is non-symmetric,
+ *   diagonals not near 1, not positive definite, or any of the
+ *   elements nan
+ */
+template <typename T_y, int R, int C>
+inline void check_corr_matrix(
+    const char* function, const char* name,
+    const Eigen::Matrix<T_y, Eigen::Dynamic, Eigen::Dynamic>& y,
+    LDLT_factor<T_y, R, C>& ldlt_y) {
+  check_square(function, name, y);
+  if (y.size() == 0) {
+    return;
+  }
+
+  internal::check_unit_diagonal(function, name, y);
+  check_symmetric(function, name, y);
+  check_ldlt_factor(function, name, ldlt_y);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -1,10 +1,10 @@
 #ifndef STAN_MATH_PRIM_FUN_CSR_MATRIX_TIMES_VECTOR_HPP
 #define STAN_MATH_PRIM_FUN_CSR_MATRIX_TIMES_VECTOR_HPP
 
+#include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/csr_u_to_z.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
-#include <stan/math/prim/fun/dot_product.hpp>
 #include <vector>
 
 namespace stan {
@@ -69,7 +69,8 @@ namespace math {
  *   for a given sparse matrix.
  * @throw std::out_of_range if any of the indexes are out of range.
  */
-template <typename T1, typename T2>
+template <typename T1, typename T2,
+          require_all_not_var_t<T1, T2>* = nullptr>
 inline Eigen::Matrix<return_type_t<T1, T2>, Eigen::Dynamic, 1>
 csr_matrix_times_vector(int m, int n,
                         const Eigen::Matrix<T1, Eigen::Dynamic, 1>& w,
@@ -89,21 +90,14 @@ csr_matrix_times_vector(int m, int n,
   }
 
   Eigen::Matrix<result_t, Eigen::Dynamic, 1> result(m);
-  result.setZero();
   for (int row = 0; row < m; ++row) {
-    int idx = csr_u_to_z(u, row);
-    int row_end_in_w = (u[row] - stan::error_index::value) + idx;
-    int i = 0;
-    Eigen::Matrix<result_t, Eigen::Dynamic, 1> b_sub(idx);
-    b_sub.setZero();
-    for (int nze = u[row] - stan::error_index::value; nze < row_end_in_w;
-         ++nze, ++i) {
-      check_range("csr_matrix_times_vector", "j", n, v[nze]);
-      b_sub.coeffRef(i) = b.coeffRef(v[nze] - stan::error_index::value);
+    int row_start_in_w = u[row] - stan::error_index::value;
+    int row_end_in_w = row_start_in_w + csr_u_to_z(u, row);
+    result_t sum(0);
+    for (int nze = row_start_in_w; nze < row_end_in_w; ++nze) {
+      sum += w.coeff(nze) * b.coeff(v[nze] - stan::error_index::value);
     }
-    Eigen::Matrix<T1, Eigen::Dynamic, 1> w_sub(
-        w.segment(u[row] - stan::error_index::value, idx));
-    result.coeffRef(row) = dot_product(w_sub, b_sub);
+    result.coeffRef(row) = sum;
   }
   return result;
 }
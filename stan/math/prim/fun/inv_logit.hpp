@@ -80,11 +80,36 @@ struct inv_logit_fun {
  * @param x container
  * @return Inverse logit applied to each value in x.
  */
-template <typename T>
+template <typename T,
+          require_not_container_st<std::is_floating_point, T>* = nullptr>
 inline auto inv_logit(const T& x) {
   return apply_scalar_unary<inv_logit_fun, T>::apply(x);
 }
 
+/**
+ * Version of inv_logit() that accepts std::vectors, Eigen Matrix/Array
+ * objects or expressions, and containers of these, of floating point
+ * values. The exponentials of the whole container are computed by Eigen
+ * at once.
+ *
+ * @tparam Container type of container
+ * @param x container
+ * @return Inverse logit applied to each value in x.
+ */
+template <typename Container,
+          require_container_st<std::is_floating_point, Container>* = nullptr>
+inline auto inv_logit(const Container& x) {
+  return apply_vector_unary<Container>::apply(x, [](const auto& v) {
+    const auto& v_arr = v.array();
+    const auto exp_m_abs_v = (-v_arr.abs()).exp().eval();
+    return (v_arr < 0)
+        .select((v_arr < LOG_EPSILON)
+                    .select(exp_m_abs_v, exp_m_abs_v / (1 + exp_m_abs_v)),
+                1 / (1 + exp_m_abs_v))
+        .eval();
+  });
+}
+
 // TODO(Tadej): Eigen is introducing their implementation logistic() of this
 // in 3.4. Use that once we switch to Eigen 3.4
 
@@ -76,11 +76,35 @@ struct log1p_fun {
  * @param x container
  * @return Elementwise log1p of members of container.
  */
-template <typename T>
+template <typename T,
+          require_not_container_st<std::is_floating_point, T>* = nullptr>
 inline auto log1p(const T& x) {
   return apply_scalar_unary<log1p_fun, T>::apply(x);
 }
 
+/**
+ * Version of <code>log1p()</code> that accepts std::vectors, Eigen
+ * Matrix/Array objects or expressions, and containers of these, of
+ * floating point values. The domain check runs once over the whole
+ * container; Eigen 3.3 has no packet implementation of log1p on the CPU,
+ * so the values themselves are still computed one element at a time.
+ *
+ * @tparam Container type of container
+ * @param x container
+ * @return Elementwise log1p of members of container.
+ * @throw std::domain_error If any argument is less than -1.
+ */
+template <typename Container,
+          require_container_st<std::is_floating_point, Container>* = nullptr>
+inline auto log1p(const Container& x) {
+  return apply_vector_unary<Container>::apply(x, [](const auto& v) {
+    if (unlikely((v.array() < -1.0).any())) {
+      check_greater_or_equal("log1p", "x", v, -1.0);
+    }
+    return v.array().log1p();
+  });
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -71,11 +71,30 @@ struct log1p_exp_fun {
  * @param x container
  * @return Natural log of (1 + exp()) applied to each value in x.
  */
-template <typename T>
+template <typename T,
+          require_not_container_st<std::is_floating_point, T>* = nullptr>
 inline auto log1p_exp(const T& x) {
   return apply_scalar_unary<log1p_exp_fun, T>::apply(x);
 }
 
+/**
+ * Version of log1p_exp() that accepts std::vectors, Eigen Matrix/Array
+ * objects or expressions, and containers of these, of floating point
+ * values. The exponentials of the whole container are computed by Eigen
+ * at once; the log1p of them is still a scalar call per element.
+ *
+ * @tparam Container type of container
+ * @param x container
+ * @return Natural log of (1 + exp()) applied to each value in x.
+ */
+template <typename Container,
+          require_container_st<std::is_floating_point, Container>* = nullptr>
+inline auto log1p_exp(const Container& x) {
+  return apply_vector_unary<Container>::apply(x, [](const auto& v) {
+    return v.array().max(0.0) + (-v.array().abs()).exp().log1p();
+  });
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -8,12 +8,59 @@
 #include <boost/math/quadrature/sinh_sinh.hpp>
 #include <boost/math/quadrature/tanh_sinh.hpp>
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <ostream>
 #include <vector>
 
 namespace stan {
 namespace math {
+namespace internal {
+
+/**
+ * Integrate f(x, xc) over the finite interval [a, b], a < b, with
+ * tanh-sinh quadrature. This is the two argument version of
+ * <code>boost::math::quadrature::tanh_sinh::integrate()</code> over
+ * [a, b], except that f may also return a vector valued type. Boost only
+ * supports those for functions of two arguments over the canonical
+ * interval [-1, 1], so the change of variables to [a, b] is done here.
+ *
+ * @tparam F type of f
+ * @param integrator tanh-sinh quadrature rule
+ * @param f the function to be integrated
+ * @param a lower limit of integration
+ * @param b upper limit of integration
+ * @param relative_tolerance target relative tolerance
+ * @param[out] error error estimate
+ * @param[out] L1 norm of the integral
+ * @param[out] levels number of refinement levels used
+ * @return numeric integral of function f
+ */
+template <typename F>
+inline auto integrate_tanh_sinh(
+    boost::math::quadrature::tanh_sinh<double>& integrator, const F& f,
+    double a, double b, double relative_tolerance, double* error, double* L1,
+    size_t* levels) {
+  using return_t = decltype(f(0.0, 0.0));
+  // zc is the distance of z to the nearest of -1 and 1, negative near -1
+  auto u = [&](double z, double zc) -> return_t {
+    if (z < 0) {
+      return f((a - b) * zc / 2 + a, (b - a) * zc / 2);
+    } else {
+      return f((a - b) * zc / 2 + b, (b - a) * zc / 2);
+    }
+  };
+  const double diff = (b - a) / 2;
+  return_t Q
+      = diff * integrator.integrate(u, relative_tolerance, error, L1, levels);
+  if (L1) {
+    *L1 *= diff;
+  }
+  return Q;
+}
+
+}  // namespace internal
+
 /**
  * Integrate a single variable function f from a to b to within a specified
  * relative tolerance. This function assumes a is less than b.
@@ -39,6 +86,14 @@ namespace math {
  *
  * If either limit is infinite, xc is set to NaN
  *
+ * f may also return a vector valued type, in which case all components
+ * are integrated on the same quadrature nodes. Such a type must be
+ * constructible from zero, support addition, subtraction and scaling
+ * by doubles, and provide an <code>abs()</code> returning a norm.
+ * Convergence is then assessed on that norm, so the relative tolerance
+ * bounds the error of each component relative to the norm of the whole
+ * integral rather than relative to the component itself.
+ *
  * @tparam T Type of f
  * @param f the function to be integrated
  * @param a lower limit of integration
@@ -48,15 +103,16 @@ namespace math {
  * @return numeric integral of function f
  */
 template <typename F>
-inline double integrate(const F& f, double a, double b,
-                        double relative_tolerance) {
+inline auto integrate(const F& f, double a, double b,
+                      double relative_tolerance) {
+  using return_t = decltype(f(0.0, 0.0));
   double error1 = 0.0;
   double error2 = 0.0;
   double L1 = 0.0;
   double L2 = 0.0;
   bool used_two_integrals = false;
   size_t levels;
-  double Q = 0.0;
+  return_t Q = 0.0;
   if (std::isinf(a) && std::isinf(b)) {
     auto f_wrap = [&](double x) { return f(x, NOT_A_NUMBER); };
     boost::math::quadrature::sinh_sinh<double> integrator;
@@ -100,14 +156,17 @@ inline double integrate(const F& f, double a, double b,
     auto f_wrap = [&](double x, double xc) { return f(x, xc); };
     boost::math::quadrature::tanh_sinh<double> integrator;
     if (a < 0.0 && b > 0.0) {
-      Q = integrator.integrate(f_wrap, a, 0.0, relative_tolerance, &error1, &L1,
-                               &levels)
-          + integrator.integrate(f_wrap, 0.0, b, relative_tolerance, &error2,
-                                 &L2, &levels);
+      Q = internal::integrate_tanh_sinh(integrator, f_wrap, a, 0.0,
+                                        relative_tolerance, &error1, &L1,
+                                        &levels)
+          + internal::integrate_tanh_sinh(integrator, f_wrap, 0.0, b,
+                                          relative_tolerance, &error2, &L2,
+                                          &levels);
       used_two_integrals = true;
     } else {
-      Q = integrator.integrate(f_wrap, a, b, relative_tolerance, &error1, &L1,
-                               &levels);
+      Q = internal::integrate_tanh_sinh(integrator, f_wrap, a, b,
+                                        relative_tolerance, &error1, &L1,
+                                        &levels);
     }
   }
 
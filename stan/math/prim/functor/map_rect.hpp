@@ -43,15 +43,15 @@ namespace math {
  * MPI parallelism takes precedence over serial or threading execution
  * of the function.
  *
- * For the threaded parallelism the N jobs are chunked into T blocks
- * which are executed asynchronously using the async C++11
- * facility. This ensure that at most T threads are used, but the
- * actual number of threads is controlled by the implementation of
- * async provided by the compiler. Note that nested calls of map_rect
- * will lead to a multiplicative increase in the number of job chunks
- * generated. The number of threads T is controlled at runtime via the
- * STAN_NUM_threads environment variable, see the get_num_threads
- * function for details.
+ * For the threaded parallelism the N jobs are split into chunks of
+ * grainsize consecutive jobs which are executed in parallel using
+ * the TBB. The outputs and gradients of all jobs in a chunk are
+ * written into a single buffer and all outputs share a single vari
+ * on the autodiff stack. Larger chunks reduce the scheduling
+ * overhead for many small jobs at the cost of a coarser load
+ * balancing. The number of threads is controlled at runtime via the
+ * STAN_NUM_THREADS environment variable, see the get_num_threads
+ * function for details. The grainsize is ignored by the MPI version.
  *
  * For the MPI version to work this function has these special
  * non-standard conventions:
@@ -110,11 +110,13 @@ namespace math {
  * dimension of job_params) and each entry must have the same size.
  * @param x_i Array of int data with the same conventions as x_r.
  * @param msgs Output stream for messages.
+ * @param grainsize Number of consecutive jobs evaluated in one chunk.
  * @tparam call_id Label for functor/data combination. See above for
  * details.
  * @tparam F Functor which is applied to all job specific parameters
  * with conventions described.
  * @return concatenated results from all jobs
+ * @throw std::domain_error if grainsize is not positive
  */
 
 template <int call_id, typename F, typename T_shared_param,
@@ -125,11 +127,12 @@ map_rect(const Eigen::Matrix<T_shared_param, Eigen::Dynamic, 1>& shared_params,
              job_params,
          const std::vector<std::vector<double>>& x_r,
          const std::vector<std::vector<int>>& x_i,
-         std::ostream* msgs = nullptr) {
+         std::ostream* msgs = nullptr, int grainsize = 1) {
   static const char* function = "map_rect";
   using return_t = Eigen::Matrix<return_type_t<T_shared_param, T_job_param>,
                                  Eigen::Dynamic, 1>;
 
+  check_positive(function, "grainsize", grainsize);
   check_matching_sizes(function, "job parameters", job_params, "real data",
                        x_r);
   check_matching_sizes(function, "job parameters", job_params, "int data", x_i);
@@ -172,7 +175,7 @@ map_rect(const Eigen::Matrix<T_shared_param, Eigen::Dynamic, 1>& shared_params,
       shared_params, job_params, x_r, x_i, msgs);
 #else
   return internal::map_rect_concurrent<call_id, F, T_shared_param, T_job_param>(
-      shared_params, job_params, x_r, x_i, msgs);
+      shared_params, job_params, x_r, x_i, msgs, grainsize);
 #endif
 }
 
@@ -9,12 +9,25 @@
 #include <stan/math/prim/functor/map_rect_reduce.hpp>
 #include <stan/math/prim/functor/map_rect_combine.hpp>
 #include <stan/math/prim/functor/mpi_parallel_call.hpp>
+#include <stan/math/prim/functor/mpi_dynamic_parallel_call.hpp>
 #include <vector>
 
 namespace stan {
 namespace math {
 namespace internal {
 
+/**
+ * The MPI parallel call used by map_rect. Jobs are scheduled
+ * dynamically if STAN_MPI_DYNAMIC is defined and statically
+ * otherwise.
+ */
+template <int call_id, typename ReduceF, typename CombineF>
+#ifdef STAN_MPI_DYNAMIC
+using map_rect_mpi_call = mpi_dynamic_parallel_call<call_id, ReduceF, CombineF>;
+#else
+using map_rect_mpi_call = mpi_parallel_call<call_id, ReduceF, CombineF>;
+#endif
+
 template <int call_id, typename F, typename T_shared_param,
           typename T_job_param>
 Eigen::Matrix<return_type_t<T_shared_param, T_job_param>, Eigen::Dynamic, 1>
@@ -31,7 +44,7 @@ map_rect_mpi(
   // back to serial execution (possible if map_rect calls are nested
   // or MPI facility used already in use)
   try {
-    mpi_parallel_call<call_id, ReduceF, CombineF> job_chunk(
+    map_rect_mpi_call<call_id, ReduceF, CombineF> job_chunk(
         shared_params, job_params, x_r, x_i);
 
     return job_chunk.reduce_combine();
@@ -53,7 +66,7 @@ map_rect_mpi(
       mpi_mr_##CALLID##_##SHARED##_##JOB##_red_;                               \
   typedef map_rect_combine<mpi_mr_##CALLID##_##SHARED##_##JOB##_, SHARED, JOB> \
       mpi_mr_##CALLID##_##SHARED##_##JOB##_comb_;                              \
-  typedef mpi_parallel_call<CALLID, mpi_mr_##CALLID##_##SHARED##_##JOB##_red_, \
+  typedef map_rect_mpi_call<CALLID, mpi_mr_##CALLID##_##SHARED##_##JOB##_red_, \
                             mpi_mr_##CALLID##_##SHARED##_##JOB##_comb_>        \
       mpi_mr_##CALLID##_##SHARED##_##JOB##_pcall_;                             \
   }                                                                            \
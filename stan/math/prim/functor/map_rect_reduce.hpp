@@ -27,6 +27,11 @@ namespace internal {
  * contain the gradients wrt to the shared and/or job specific
  * parameters (in this order).
  *
+ * A second signature appends the same matrix in column-major order
+ * to a given buffer and returns the number of outputs of the
+ * job. This allows callers to collect the results of many jobs in a
+ * single buffer without allocating a matrix per job.
+ *
  * No higher order output format is defined yet.
  *
  * @tparam F user functor
@@ -46,6 +51,15 @@ class map_rect_reduce<F, double, double> {
                       std::ostream* msgs = nullptr) const {
     return F()(shared_params, job_specific_params, x_r, x_i, msgs).transpose();
   }
+
+  int operator()(const vector_d& shared_params,
+                 const vector_d& job_specific_params,
+                 const std::vector<double>& x_r, const std::vector<int>& x_i,
+                 std::vector<double>& out, std::ostream* msgs = nullptr) const {
+    const vector_d fx = F()(shared_params, job_specific_params, x_r, x_i, msgs);
+    out.insert(out.end(), fx.data(), fx.data() + fx.size());
+    return fx.size();
+  }
 };
 
 }  // namespace internal
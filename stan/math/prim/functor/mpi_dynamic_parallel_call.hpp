@@ -0,0 +1,426 @@
+#ifdef STAN_MPI
+
+#ifndef STAN_MATH_PRIM_FUNCTOR_MPI_DYNAMIC_PARALLEL_CALL_HPP
+#define STAN_MATH_PRIM_FUNCTOR_MPI_DYNAMIC_PARALLEL_CALL_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/dims.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/fun/typedefs.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/functor/mpi_cluster.hpp>
+#include <stan/math/prim/functor/mpi_distributed_apply.hpp>
+#include <stan/math/prim/functor/mpi_parallel_call.hpp>
+
+#include <boost/serialization/vector.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * The MPI dynamic parallel call class manages the distributed
+ * evaluation of a collection of tasks following the map - reduce -
+ * combine pattern with dynamic scheduling of the jobs. It is a drop-in
+ * replacement of mpi_parallel_call for jobs with a strongly varying
+ * cost, for which the static chunking of mpi_parallel_call leaves most
+ * workers idle while the slowest one finishes.
+ *
+ * The flow of commands are:
+ *
+ * 1. The constructor of this class must be called on the root node where
+ *    all parameters and static data is passed to the class. The
+ *    constructor allocates the MPI cluster resource and instructs the
+ *    workers to run the static distributed_apply method of this class.
+ * 2. The static data is broadcasted once to all nodes and cached such
+ *    that any node can evaluate any job. The shapes of the parameters
+ *    are cached in the same way.
+ * 3. The parameters are broadcasted with a non-blocking collective. The
+ *    root starts to evaluate jobs right away while the parameters are
+ *    in flight and the workers only wait for them once they have been
+ *    assigned their first block of jobs.
+ * 4. The jobs are scheduled dynamically by the root. Each worker
+ *    requests a block of consecutive jobs from the root, evaluates it
+ *    and sends the results back with its next request. The block size
+ *    decreases with the number of remaining jobs (guided scheduling)
+ *    such that the cost of the last blocks is small. In between its
+ *    own jobs the root answers the requests of the workers and
+ *    collects their results.
+ * 5. Once all jobs are done, the results are combined on the root with
+ *    the combine functor along with the ragged array data structure,
+ *    which may change between evaluations.
+ *
+ * As for mpi_parallel_call, a job which fails on any node is only
+ * flagged to keep the cluster synchronized. The root raises an
+ * exception once all nodes have finished.
+ *
+ * @tparam call_id label for the static data
+ * @tparam ReduceF reduce function called for each job, \see
+ * internal::map_rect_reduce
+ * @tparam CombineF combine function called on the combined results on
+ * each job along with the ragged data structure information, \see
+ * internal::map_rect_combine
+ */
+template <int call_id, typename ReduceF, typename CombineF>
+class mpi_dynamic_parallel_call {
+  boost::mpi::communicator world_;
+  const std::size_t rank_ = world_.rank();
+  const std::size_t world_size_ = world_.size();
+  std::unique_lock<std::mutex> cluster_lock_;
+
+  using result_t = typename CombineF::result_t;
+
+  // local caches which hold the data of all jobs and the number of
+  // jobs, shared and job specific parameters
+  using cache_x_r
+      = internal::mpi_parallel_call_cache<call_id, 5,
+                                          std::vector<std::vector<double>>>;
+  using cache_x_i
+      = internal::mpi_parallel_call_cache<call_id, 6,
+                                          std::vector<std::vector<int>>>;
+  using cache_dims
+      = internal::mpi_parallel_call_cache<call_id, 7, std::vector<int>>;
+
+  // tags of the messages with the results of a block of jobs, which
+  // double as requests for the next block, and of the assignments
+  static constexpr int results_tag_ = 1;
+  static constexpr int assignment_tag_ = 2;
+
+  CombineF combine_;
+
+  int num_jobs_;
+  int num_shared_params_;
+  int num_job_params_;
+
+  // shared parameters followed by the job specific parameters of all
+  // jobs, the root broadcasts a copy
+  std::vector<double> params_;
+  std::vector<double> params_send_;
+  MPI_Request params_request_;
+
+ public:
+  /**
+   * Initiates a parallel MPI call on the root. The constructor
+   * allocates the MPI resource, initiates on all workers the MPI
+   * parallel call and starts the broadcast of the parameters.
+   *
+   * @tparam T_shared_param type of shared parameters
+   * @tparam T_job_param type of job-specific parameters
+   * @param shared_params shared parameter vector
+   * @param job_params array of job-specific parameter vectors
+   * @param x_r array of job-specific real arrays (data only argument)
+   * @param x_i array of job-specific int arrays (data only argument)
+   */
+  template <typename T_shared_param, typename T_job_param>
+  mpi_dynamic_parallel_call(
+      const Eigen::Matrix<T_shared_param, Eigen::Dynamic, 1>& shared_params,
+      const std::vector<Eigen::Matrix<T_job_param, Eigen::Dynamic, 1>>&
+          job_params,
+      const std::vector<std::vector<double>>& x_r,
+      const std::vector<std::vector<int>>& x_i)
+      : combine_(shared_params, job_params) {
+    if (rank_ != 0)
+      throw std::runtime_error(
+          "problem sizes may only be defined on the root.");
+
+    check_matching_sizes("mpi_dynamic_parallel_call", "job parameters",
+                         job_params, "continuous data", x_r);
+    check_matching_sizes("mpi_dynamic_parallel_call", "job parameters",
+                         job_params, "integer data", x_i);
+
+    const std::vector<int> job_dims = dims(job_params);
+    const int num_jobs = job_dims[0];
+    const int num_job_params = num_jobs == 0 ? 0 : job_dims[1];
+
+    if (cache_dims::is_valid()) {
+      const std::vector<int>& cached_dims = cache_dims::data();
+      check_size_match("mpi_dynamic_parallel_call", "cached number of jobs",
+                       cached_dims[0], "number of jobs", num_jobs);
+      check_size_match("mpi_dynamic_parallel_call",
+                       "cached number of shared parameters", cached_dims[1],
+                       "number of shared parameters", shared_params.size());
+      check_size_match("mpi_dynamic_parallel_call",
+                       "cached number of job specific parameters",
+                       cached_dims[2], "number of job specific parameters",
+                       num_job_params);
+    }
+
+    // make children aware of upcoming job & obtain cluster lock
+    cluster_lock_ = mpi_broadcast_command<stan::math::mpi_distributed_apply<
+        mpi_dynamic_parallel_call<call_id, ReduceF, CombineF>>>();
+
+    const int num_shared_params = shared_params.size();
+    params_.resize(num_shared_params + num_jobs * num_job_params);
+    Eigen::Map<vector_d>(params_.data(), num_shared_params)
+        = value_of(shared_params);
+    for (int j = 0; j < num_jobs; ++j) {
+      Eigen::Map<vector_d>(
+          params_.data() + num_shared_params + j * num_job_params,
+          num_job_params)
+          = value_of(job_params[j]);
+    }
+    params_send_ = params_;
+
+    setup_call({num_jobs, num_shared_params, num_job_params}, x_r, x_i);
+  }
+
+  // called on remote sites
+  mpi_dynamic_parallel_call() : combine_() {
+    if (rank_ == 0)
+      throw std::runtime_error("problem sizes must be defined on the root.");
+
+    setup_call(std::vector<int>(), std::vector<std::vector<double>>(),
+               std::vector<std::vector<int>>());
+  }
+
+  /**
+   * Entry point on the workers for the mpi_dynamic_parallel_call.
+   */
+  static void distributed_apply() {
+    // call constructor for the remotes
+    mpi_dynamic_parallel_call<call_id, ReduceF, CombineF> job_chunk;
+
+    job_chunk.reduce_combine();
+  }
+
+  /**
+   * Evaluates all jobs with dynamic scheduling. The workers evaluate
+   * the blocks of jobs assigned to them by the root, while the root
+   * evaluates jobs itself, assigns blocks to the workers and finally
+   * combines all results.
+   */
+  result_t reduce_combine() {
+    if (rank_ != 0) {
+      evaluate_assigned_jobs();
+      return result_t();
+    }
+
+    const std::vector<std::vector<double>>& x_r = cache_x_r::data();
+    const std::vector<std::vector<int>>& x_i = cache_x_i::data();
+    const vector_d shared_params
+        = Eigen::Map<const vector_d>(params_.data(), num_shared_params_);
+
+    std::vector<int> world_f_out(num_jobs_, 0);
+    std::vector<int> block_first_job;
+    std::vector<int> block_num_jobs;
+    std::vector<std::vector<double>> block_output;
+
+    int next_job = 0;
+    int num_active_workers = world_size_ - 1;
+    int params_sent = 0;
+    bool all_ok = true;
+
+    while (next_job < num_jobs_ || num_active_workers > 0) {
+      boost::optional<boost::mpi::status> status;
+      if (next_job < num_jobs_) {
+        MPI_Test(&params_request_, &params_sent, MPI_STATUS_IGNORE);
+        status = world_.iprobe(boost::mpi::any_source, results_tag_);
+      } else {
+        status = world_.probe(boost::mpi::any_source, results_tag_);
+      }
+
+      if (status) {
+        // collect the results of the last block of the worker, if
+        // any, and assign it the next block
+        const int source = status->source();
+        std::vector<int> header;
+        std::vector<double> output;
+        world_.recv(source, results_tag_, header);
+        world_.recv(source, results_tag_, output);
+        if (!header.empty()) {
+          all_ok = all_ok && header[0] == 1;
+          std::copy(header.begin() + 2, header.end(),
+                    world_f_out.begin() + header[1]);
+          block_first_job.push_back(header[1]);
+          block_num_jobs.push_back(header.size() - 2);
+          block_output.push_back(std::move(output));
+        }
+
+        const int block_size = std::max<int>(
+            1, (num_jobs_ - next_job) / (2 * world_size_));
+        int assignment[2]
+            = {next_job, std::min(next_job + block_size, num_jobs_)};
+        world_.send(source, assignment_tag_, assignment, 2);
+        next_job = assignment[1];
+        if (assignment[0] == assignment[1]) {
+          --num_active_workers;
+        }
+        continue;
+      }
+
+      // consecutive jobs of the root are collected in one block
+      if (block_first_job.empty()
+          || block_first_job.back() + block_num_jobs.back() != next_job) {
+        block_first_job.push_back(next_job);
+        block_num_jobs.push_back(0);
+        block_output.emplace_back();
+      }
+      try {
+        world_f_out[next_job] = ReduceF()(
+            shared_params, job_params(next_job), x_r[next_job],
+            x_i[next_job], block_output.back(), 0);
+      } catch (const std::exception& e) {
+        // see the note in mpi_parallel_call on why we do not rethrow
+        // here, but merely flag it to keep the cluster synchronized
+        all_ok = false;
+      }
+      ++block_num_jobs.back();
+      ++next_job;
+    }
+
+    MPI_Wait(&params_request_, MPI_STATUS_IGNORE);
+
+    if (!all_ok)
+      throw std::domain_error("Error during MPI evaluation.");
+
+    std::vector<int> output_offset(num_jobs_ + 1, 0);
+    std::partial_sum(world_f_out.begin(), world_f_out.end(),
+                     output_offset.begin() + 1);
+
+    int num_rows = 1;
+    for (std::size_t b = 0; b < block_output.size(); ++b) {
+      const int num_block_outputs
+          = output_offset[block_first_job[b] + block_num_jobs[b]]
+            - output_offset[block_first_job[b]];
+      if (num_block_outputs > 0) {
+        num_rows = block_output[b].size() / num_block_outputs;
+        break;
+      }
+    }
+
+    matrix_d world_result(num_rows, output_offset[num_jobs_]);
+    for (std::size_t b = 0; b < block_output.size(); ++b) {
+      std::copy(block_output[b].begin(), block_output[b].end(),
+                world_result.data()
+                    + output_offset[block_first_job[b]] * num_rows);
+    }
+
+    return combine_(world_result, world_f_out);
+  }
+
+ private:
+  /**
+   * Returns the job specific parameters of a job.
+   *
+   * @param job index of the job
+   * @return job specific parameters
+   */
+  vector_d job_params(int job) const {
+    return Eigen::Map<const vector_d>(
+        params_.data() + num_shared_params_ + job * num_job_params_,
+        num_job_params_);
+  }
+
+  /**
+   * Requests blocks of jobs from the root and evaluates them on a
+   * worker until no jobs are left. The results of each block are
+   * sent along with the request for the next block. Each message
+   * consists of a header with a status flag, the first job of the
+   * block and the number of outputs of each job, followed by the
+   * outputs of all jobs in the block.
+   */
+  void evaluate_assigned_jobs() {
+    const std::vector<std::vector<double>>& x_r = cache_x_r::data();
+    const std::vector<std::vector<int>>& x_i = cache_x_i::data();
+    vector_d shared_params;
+    bool params_received = false;
+
+    std::vector<int> header;
+    std::vector<double> output;
+    while (true) {
+      world_.send(0, results_tag_, header);
+      world_.send(0, results_tag_, output);
+
+      int assignment[2];
+      world_.recv(0, assignment_tag_, assignment, 2);
+      if (assignment[0] == assignment[1]) {
+        break;
+      }
+
+      if (!params_received) {
+        MPI_Wait(&params_request_, MPI_STATUS_IGNORE);
+        shared_params
+            = Eigen::Map<const vector_d>(params_.data(), num_shared_params_);
+        params_received = true;
+      }
+
+      header.assign({1, assignment[0]});
+      output.clear();
+      try {
+        for (int i = assignment[0]; i < assignment[1]; ++i) {
+          header.push_back(ReduceF()(shared_params, job_params(i), x_r[i],
+                                     x_i[i], output, 0));
+        }
+      } catch (const std::exception& e) {
+        // the failure is raised on the root once all jobs are done
+        header[0] = 0;
+      }
+    }
+
+    // the broadcast must complete even if no jobs were assigned
+    MPI_Wait(&params_request_, MPI_STATUS_IGNORE);
+  }
+
+  /**
+   * Performs a cached broadcast of a (nested) std::vector. On the
+   * first call the data on the root is broadcasted to all workers and
+   * is stored in the cache locally. Any subsequent calls will
+   * immediately return the cached data.
+   *
+   * @tparam T_cache static data storage type
+   * @param data vector to be broadcasted from the root and a dummy
+   * argument on workers
+   * @return broadcasted vector originating from the root
+   */
+  template <typename T_cache>
+  typename T_cache::cache_t& broadcast_cached(
+      typename T_cache::cache_t& data) {
+    if (T_cache::is_valid()) {
+      return T_cache::data();
+    }
+
+    auto local_data = data;
+    boost::mpi::broadcast(world_, local_data, 0);
+    T_cache::store(local_data);
+    return T_cache::data();
+  }
+
+  void setup_call(const std::vector<int>& problem_dims,
+                  const std::vector<std::vector<double>>& x_r,
+                  const std::vector<std::vector<int>>& x_i) {
+    const std::vector<int>& dims = broadcast_cached<cache_dims>(problem_dims);
+    num_jobs_ = dims[0];
+    num_shared_params_ = dims[1];
+    num_job_params_ = dims[2];
+
+    // distribute const data if not yet cached
+    broadcast_cached<cache_x_r>(x_r);
+    broadcast_cached<cache_x_i>(x_i);
+
+    params_.resize(num_shared_params_ + num_jobs_ * num_job_params_);
+    double* params_buffer = rank_ == 0 ? params_send_.data() : params_.data();
+    MPI_Ibcast(params_buffer, params_.size(), MPI_DOUBLE, 0, world_,
+               &params_request_);
+  }
+};
+
+template <int call_id, typename ReduceF, typename CombineF>
+constexpr int
+    mpi_dynamic_parallel_call<call_id, ReduceF, CombineF>::results_tag_;
+
+template <int call_id, typename ReduceF, typename CombineF>
+constexpr int
+    mpi_dynamic_parallel_call<call_id, ReduceF, CombineF>::assignment_tag_;
+
+}  // namespace math
+}  // namespace stan
+
+#endif
+
+#endif
@@ -0,0 +1,264 @@
+#ifndef STAN_MATH_PRIM_FUNCTOR_REDUCE_SUM_HPP
+#define STAN_MATH_PRIM_FUNCTOR_REDUCE_SUM_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/functor/apply.hpp>
+
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * reduce_sum_impl implementation for any autodiff type.
+ *
+ * @tparam ReduceFunction Type of reducer function
+ * @tparam ReturnType An arithmetic type
+ * @tparam Vec Type of sliced argument
+ * @tparam Args Types of shared arguments
+ */
+template <typename ReduceFunction, typename Enable, typename ReturnType,
+          typename Vec, typename... Args>
+struct reduce_sum_impl;
+
+/**
+ * Specialization of reduce_sum_impl for arithmetic types
+ *
+ * @tparam ReduceFunction Type of reducer function
+ * @tparam ReturnType An arithmetic type
+ * @tparam Vec Type of sliced argument
+ * @tparam Args Types of shared arguments
+ */
+template <typename ReduceFunction, typename ReturnType, typename Vec,
+          typename... Args>
+struct reduce_sum_impl<ReduceFunction, require_arithmetic_t<ReturnType>,
+                       ReturnType, Vec, Args...> {
+  /**
+   * This struct is used by the TBB to accumulate partial
+   *  sums over consecutive ranges of the input. To distribute the workload,
+   *  the TBB can split larger partial sums into smaller ones in which
+   *  case the splitting copy constructor is used. It is designed to
+   *  meet the Imperative form requirements of `tbb::parallel_reduce`.
+   *
+   * @note see link [here](https://tinyurl.com/vp7xw2t) for requirements.
+   */
+  struct recursive_reducer {
+    Vec vmapped_;
+    std::ostream* msgs_;
+    std::tuple<Args...> args_tuple_;
+    return_type_t<Vec, Args...> sum_{0.0};
+
+    recursive_reducer(Vec&& vmapped, std::ostream* msgs, Args&&... args)
+        : vmapped_(std::forward<Vec>(vmapped)),
+          msgs_(msgs),
+          args_tuple_(std::forward<Args>(args)...) {}
+
+    /**
+     * Visible splitting copy constructor required by TBB. The new
+     *  reducer starts from a zero partial sum.
+     *
+     * @param other reducer to split
+     */
+    recursive_reducer(recursive_reducer& other, tbb::split)
+        : vmapped_(other.vmapped_),
+          msgs_(other.msgs_),
+          args_tuple_(other.args_tuple_) {}
+
+    /**
+     * Compute the value of the reduction over the range `r` and
+     *  accumulate it into the partial sum of this reducer.
+     *
+     * @param r Range over which to compute `reduce_sum`
+     */
+    inline void operator()(const tbb::blocked_range<size_t>& r) {
+      if (r.empty()) {
+        return;
+      }
+
+      std::decay_t<Vec> sub_slice;
+      sub_slice.reserve(r.size());
+      for (size_t i = r.begin(); i < r.end(); ++i) {
+        sub_slice.emplace_back(vmapped_[i]);
+      }
+
+      sum_ += apply(
+          [&](auto&&... args) {
+            return ReduceFunction()(sub_slice, r.begin(), r.end() - 1, msgs_,
+                                    args...);
+          },
+          args_tuple_);
+    }
+
+    /**
+     * Join reducers. Accumulates the partial sum of `rhs`.
+     *
+     * @param rhs Another partial sum
+     */
+    inline void join(const recursive_reducer& rhs) { sum_ += rhs.sum_; }
+  };
+
+  /**
+   * Call an instance of the function `ReduceFunction` on every element
+   *   of an input sequence and sum these terms.
+   *
+   * The sequence is split into slices of size at least `grainsize` which
+   *   are handed to the TBB work stealing scheduler. With
+   *   `auto_partitioning` the TBB chooses the slice sizes adaptively,
+   *   otherwise slices of at most `grainsize` elements are formed
+   *   deterministically so that repeated calls sum the same terms in the
+   *   same order.
+   *
+   * `ReduceFunction` must define an operator() with the signature:
+   *   T operator()(Vec&& vmapped_subset, int start, int end,
+   *                std::ostream* msgs, Args&&... args)
+   *
+   *   where `vmapped_subset` holds the elements `start` to `end` (both
+   *   inclusive and zero based) of `vmapped`.
+   *
+   * @param vmapped Sliced arguments used only in some sum terms
+   * @param auto_partitioning Work partitioning style
+   * @param grainsize Suggested grainsize for tbb
+   * @param[in, out] msgs The print stream for warning messages
+   * @param args Shared arguments used in every sum term
+   * @return Summation of all terms
+   */
+  inline ReturnType operator()(Vec&& vmapped, bool auto_partitioning,
+                               int grainsize, std::ostream* msgs,
+                               Args&&... args) const {
+    const std::size_t num_terms = vmapped.size();
+    if (vmapped.empty()) {
+      return 0.0;
+    }
+    recursive_reducer worker(std::forward<Vec>(vmapped), msgs,
+                             std::forward<Args>(args)...);
+
+    if (auto_partitioning) {
+      tbb::parallel_reduce(
+          tbb::blocked_range<std::size_t>(0, num_terms, grainsize), worker);
+    } else {
+      tbb::simple_partitioner partitioner;
+      tbb::parallel_deterministic_reduce(
+          tbb::blocked_range<std::size_t>(0, num_terms, grainsize), worker,
+          partitioner);
+    }
+
+    return std::move(worker.sum_);
+  }
+};
+
+}  // namespace internal
+
+/**
+ * Call an instance of the function `ReduceFunction` on every element
+ *   of an input sequence and sum these terms.
+ *
+ * This defers to reduce_sum_impl for the appropriate implementation.
+ *
+ * `ReduceFunction` must define an operator() with the signature:
+ *   T operator()(Vec&& vmapped_subset, int start, int end,
+ *                std::ostream* msgs, Args&&... args)
+ *
+ * `reduce_sum` computes the sum of `ReduceFunction` applied to consecutive
+ *   slices of `vmapped` (elements `start` to `end`, zero based and
+ *   inclusive). The shared arguments `args` are passed unchanged to every
+ *   call. The slices are chosen by the TBB work stealing scheduler and
+ *   are of size at least `grainsize`. When `STAN_THREADS` is not defined
+ *   `ReduceFunction` is called once over the whole sequence.
+ *
+ * @tparam ReduceFunction Type of reducer function
+ * @tparam Vec Type of sliced argument
+ * @tparam Args Types of shared arguments
+ * @param vmapped Sliced arguments used only in some sum terms
+ * @param grainsize Suggested grainsize for tbb
+ * @param[in, out] msgs The print stream for warning messages
+ * @param args Shared arguments used in every sum term
+ * @return Sum of terms
+ * @throw std::domain_error if `grainsize` is not positive
+ */
+template <typename ReduceFunction, typename Vec,
+          typename = require_vector_like_t<Vec>, typename... Args>
+inline auto reduce_sum(Vec&& vmapped, int grainsize, std::ostream* msgs,
+                       Args&&... args) {
+  using return_type = return_type_t<Vec, Args...>;
+
+  check_positive("reduce_sum", "grainsize", grainsize);
+
+#ifdef STAN_THREADS
+  return internal::reduce_sum_impl<ReduceFunction, void, return_type, Vec,
+                                   Args...>()(std::forward<Vec>(vmapped), true,
+                                              grainsize, msgs,
+                                              std::forward<Args>(args)...);
+#else
+  if (vmapped.empty()) {
+    return return_type(0.0);
+  }
+
+  return ReduceFunction()(std::forward<Vec>(vmapped), 0, vmapped.size() - 1,
+                          msgs, std::forward<Args>(args)...);
+#endif
+}
+
+/**
+ * Call an instance of the function `ReduceFunction` on every element
+ *   of an input sequence and sum these terms using deterministic
+ *   slices of at most `grainsize` elements.
+ *
+ * Unlike `reduce_sum` the partitioning of the work does not depend on
+ *   the runtime load of the threads, so the floating point summation
+ *   order, and hence the result, is reproducible across calls. The same
+ *   slices are used when `STAN_THREADS` is not defined, in which case
+ *   they are evaluated sequentially.
+ *
+ * @tparam ReduceFunction Type of reducer function
+ * @tparam Vec Type of sliced argument
+ * @tparam Args Types of shared arguments
+ * @param vmapped Sliced arguments used only in some sum terms
+ * @param grainsize Maximal number of terms in each slice
+ * @param[in, out] msgs The print stream for warning messages
+ * @param args Shared arguments used in every sum term
+ * @return Sum of terms
+ * @throw std::domain_error if `grainsize` is not positive
+ */
+template <typename ReduceFunction, typename Vec,
+          typename = require_vector_like_t<Vec>, typename... Args>
+inline auto reduce_sum_static(Vec&& vmapped, int grainsize,
+                              std::ostream* msgs, Args&&... args) {
+  using return_type = return_type_t<Vec, Args...>;
+
+  check_positive("reduce_sum_static", "grainsize", grainsize);
+
+#ifdef STAN_THREADS
+  return internal::reduce_sum_impl<ReduceFunction, void, return_type, Vec,
+                                   Args...>()(std::forward<Vec>(vmapped), false,
+                                              grainsize, msgs,
+                                              std::forward<Args>(args)...);
+#else
+  const std::size_t num_terms = vmapped.size();
+  return_type sum = 0.0;
+  for (std::size_t start = 0; start < num_terms; start += grainsize) {
+    const std::size_t end
+        = std::min(num_terms, start + static_cast<std::size_t>(grainsize));
+    std::decay_t<Vec> sub_slice;
+    sub_slice.reserve(end - start);
+    for (std::size_t i = start; i < end; ++i) {
+      sub_slice.emplace_back(vmapped[i]);
+    }
+    sum += ReduceFunction()(sub_slice, start, end - 1, msgs, args...);
+  }
+  return sum;
+#endif
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
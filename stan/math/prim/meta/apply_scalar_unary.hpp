@@ -2,9 +2,13 @@
 #define STAN_MATH_PRIM_META_APPLY_SCALAR_UNARY_HPP
 
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/meta/bool_constant.hpp>
 #include <stan/math/prim/meta/is_eigen.hpp>
+#include <stan/math/prim/meta/is_var.hpp>
 #include <stan/math/prim/meta/is_vector.hpp>
 #include <stan/math/prim/meta/is_vector_like.hpp>
+#include <stan/math/prim/meta/require_helpers.hpp>
+#include <stan/math/prim/meta/value_type.hpp>
 #include <utility>
 #include <vector>
 
@@ -40,13 +44,17 @@ struct apply_scalar_unary;
 /**
  *
  * Template specialization for vectorized functions applying to
- * Eigen matrix arguments.
+ * Eigen matrix arguments. Matrices of reverse mode autodiff variables
+ * are specialized in the rev library.
  *
  * @tparam F Type of function to apply.
  * @tparam T Type of argument to which function is applied.
  */
 template <typename F, typename T>
-struct apply_scalar_unary<F, T, require_eigen_t<T>> {
+struct apply_scalar_unary<
+    F, T,
+    require_t<bool_constant<is_eigen<T>::value
+                            && !is_var<value_type_t<T>>::value>>> {
   /**
    * Type of underlying scalar for the matrix type T.
    */
@@ -0,0 +1,30 @@
+#ifndef STAN_MATH_PRIM_META_IS_VAR_MATRIX_HPP
+#define STAN_MATH_PRIM_META_IS_VAR_MATRIX_HPP
+
+#include <type_traits>
+
+namespace stan {
+
+/** \ingroup type_trait
+ * Checks whether the type is a matrix variable in struct-of-arrays form,
+ * i.e. a <code>var_matrix</code>. The specialization for
+ * <code>var_matrix</code> is defined in rev, such that prim functions
+ * can step aside for the overloads of matrix variables.
+ */
+template <typename T>
+struct is_var_matrix : std::false_type {};
+
+/** \ingroup type_trait
+ * Specializations ignoring cv qualifiers and references.
+ */
+template <typename T>
+struct is_var_matrix<const T> : is_var_matrix<T> {};
+
+template <typename T>
+struct is_var_matrix<T&> : is_var_matrix<T> {};
+
+template <typename T>
+struct is_var_matrix<T&&> : is_var_matrix<T> {};
+
+}  // namespace stan
+#endif
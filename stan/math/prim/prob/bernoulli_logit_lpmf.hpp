@@ -7,6 +7,7 @@
 #include <stan/math/prim/fun/log1p.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
+#include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <cmath>
 
@@ -28,7 +29,6 @@ namespace math {
 template <bool propto, typename T_n, typename T_prob>
 return_type_t<T_prob> bernoulli_logit_lpmf(const T_n& n, const T_prob& theta) {
   using T_partials_return = partials_return_t<T_n, T_prob>;
-  using std::exp;
   static const char* function = "bernoulli_logit_lpmf";
   check_bounded(function, "n", n, 0, 1);
   check_not_nan(function, "Logit transformed probability parameter", theta);
@@ -49,32 +49,33 @@ return_type_t<T_prob> bernoulli_logit_lpmf(const T_n& n, const T_prob& theta) {
   scalar_seq_view<T_prob> theta_vec(theta);
   size_t N = max_size(n, theta);
 
+  Eigen::Array<T_partials_return, Eigen::Dynamic, 1> signs(N);
+  Eigen::Array<T_partials_return, Eigen::Dynamic, 1> ntheta(N);
   for (size_t n = 0; n < N; n++) {
-    const T_partials_return theta_dbl = value_of(theta_vec[n]);
+    signs[n] = 2 * n_vec[n] - 1;
+    ntheta[n] = signs[n] * value_of(theta_vec[n]);
+  }
+  const Eigen::Array<T_partials_return, Eigen::Dynamic, 1> exp_m_ntheta
+      = exp(-ntheta);
 
-    const int sign = 2 * n_vec[n] - 1;
-    const T_partials_return ntheta = sign * theta_dbl;
-    const T_partials_return exp_m_ntheta = exp(-ntheta);
+  // Handle extreme values gracefully using Taylor approximations.
+  static const double cutoff = 20.0;
+  logp += sum(
+      (ntheta > cutoff)
+          .select(-exp_m_ntheta,
+                  (ntheta < -cutoff).select(ntheta, -log1p(exp_m_ntheta))));
 
-    // Handle extreme values gracefully using Taylor approximations.
-    static const double cutoff = 20.0;
-    if (ntheta > cutoff) {
-      logp -= exp_m_ntheta;
-    } else if (ntheta < -cutoff) {
-      logp += ntheta;
+  if (!is_constant_all<T_prob>::value) {
+    Eigen::Matrix<T_partials_return, Eigen::Dynamic, 1> theta_derivative
+        = (ntheta > cutoff)
+              .select(-exp_m_ntheta,
+                      (ntheta < -cutoff)
+                          .select(signs,
+                                  signs * exp_m_ntheta / (exp_m_ntheta + 1)));
+    if (is_vector<T_prob>::value) {
+      ops_partials.edge1_.partials_ = theta_derivative;
     } else {
-      logp -= log1p(exp_m_ntheta);
-    }
-
-    if (!is_constant_all<T_prob>::value) {
-      if (ntheta > cutoff) {
-        ops_partials.edge1_.partials_[n] -= exp_m_ntheta;
-      } else if (ntheta < -cutoff) {
-        ops_partials.edge1_.partials_[n] += sign;
-      } else {
-        ops_partials.edge1_.partials_[n]
-            += sign * exp_m_ntheta / (exp_m_ntheta + 1);
-      }
+      ops_partials.edge1_.partials_[0] = sum(theta_derivative);
     }
   }
   return ops_partials.build(logp);
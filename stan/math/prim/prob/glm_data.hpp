@@ -0,0 +1,68 @@
+#ifndef STAN_MATH_PRIM_PROB_GLM_DATA_HPP
+#define STAN_MATH_PRIM_PROB_GLM_DATA_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/lgamma.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/fun/value_of_rec.hpp>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Return the sum of `lgamma(y + 1)` over the elements of `y`, the
+ * normalizing term of the count GLM log densities.
+ *
+ * @tparam T_y type of the scalar or vector of counts
+ * @param y scalar or vector of counts
+ * @return sum of the log factorials of the counts
+ */
+template <typename T_y>
+inline double sum_lgamma_plus_1(const T_y& y) {
+  const auto& y_val = value_of_rec(y);
+  return sum(lgamma(as_array_or_scalar(as_column_vector_or_scalar(y_val)) + 1));
+}
+}  // namespace internal
+
+/** \ingroup multivar_dists
+ * The dependent and independent variables of a Generalized Linear Model
+ * (GLM), together with the terms of its log density that depend on them
+ * only. Passing a `glm_data` to a GLM in place of `y` and `x` avoids
+ * recomputing those terms on every evaluation of the log density, e.g.
+ * at every leapfrog step.
+ *
+ * @tparam T_y type of the scalar or vector of dependent variables (labels)
+ * @tparam T_x type of the matrix of independent variables (features)
+ */
+template <typename T_y, typename T_x>
+class glm_data {
+ public:
+  /**
+   * Construct the data of a GLM, copying the variables and computing the
+   * terms of the log density that depend on them only.
+   *
+   * @param y scalar or vector of dependent variables
+   * @param x matrix or row vector of independent variables
+   */
+  glm_data(const T_y& y, const T_x& x)
+      : y_(y), x_(x), sum_lgamma_y_plus_1_(internal::sum_lgamma_plus_1(y)) {}
+
+  inline const T_y& y() const { return y_; }
+
+  inline const T_x& x() const { return x_; }
+
+  /**
+   * Return the sum of `lgamma(y + 1)` over the elements of `y`.
+   */
+  inline double sum_lgamma_y_plus_1() const { return sum_lgamma_y_plus_1_; }
+
+ private:
+  T_y y_;
+  T_x x_;
+  double sum_lgamma_y_plus_1_;
+};
+
+}  // namespace math
+}  // namespace stan
+#endif
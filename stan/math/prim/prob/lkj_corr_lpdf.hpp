@@ -4,9 +4,10 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/LDLT_factor.hpp>
 #include <stan/math/prim/fun/lgamma.hpp>
 #include <stan/math/prim/fun/log.hpp>
-#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/fun/log_determinant_ldlt.hpp>
 
 namespace stan {
 namespace math {
@@ -52,13 +53,17 @@ return_type_t<T_y, T_shape> lkj_corr_lpdf(
 
   return_type_t<T_y, T_shape> lp(0.0);
   check_positive(function, "Shape parameter", eta);
-  check_corr_matrix(function, "Correlation matrix", y);
+  check_square(function, "Correlation matrix", y);
 
   const unsigned int K = y.rows();
   if (K == 0) {
     return 0.0;
   }
 
+  // the factor validates y and provides its log determinant
+  LDLT_factor<T_y, Eigen::Dynamic, Eigen::Dynamic> ldlt_y(y);
+  check_corr_matrix(function, "Correlation matrix", y, ldlt_y);
+
   if (include_summand<propto, T_shape>::value) {
     lp += do_lkj_constant(eta, K);
   }
@@ -71,8 +76,7 @@ return_type_t<T_y, T_shape> lkj_corr_lpdf(
     return lp;
   }
 
-  T_y sum_values = sum(log(y.ldlt().vectorD()));
-  lp += (eta - 1.0) * sum_values;
+  lp += (eta - 1.0) * log_determinant_ldlt(ldlt_y);
   return lp;
 }
 
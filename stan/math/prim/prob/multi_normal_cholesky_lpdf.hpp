@@ -4,13 +4,11 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/constants.hpp>
-#include <stan/math/prim/fun/dot_self.hpp>
 #include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/max_size_mvt.hpp>
-#include <stan/math/prim/fun/mdivide_left_tri.hpp>
 #include <stan/math/prim/fun/size_mvt.hpp>
 #include <stan/math/prim/fun/sum.hpp>
-#include <stan/math/prim/fun/transpose.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
 
 namespace stan {
 namespace math {
@@ -47,9 +45,6 @@ return_type_t<T_y, T_loc, T_covar> multi_normal_cholesky_lpdf(
   using T_partials_return = partials_return_t<T_y, T_loc, T_covar>;
   using matrix_partials_t
       = Eigen::Matrix<T_partials_return, Eigen::Dynamic, Eigen::Dynamic>;
-  using vector_partials_t = Eigen::Matrix<T_partials_return, Eigen::Dynamic, 1>;
-  using row_vector_partials_t
-      = Eigen::Matrix<T_partials_return, 1, Eigen::Dynamic>;
 
   check_consistent_sizes_mvt(function, "y", y, "mu", mu);
   size_t number_of_y = size_mvt(y);
@@ -115,46 +110,49 @@ return_type_t<T_y, T_loc, T_covar> multi_normal_cholesky_lpdf(
     logp += NEG_LOG_SQRT_TWO_PI * size_y * size_vec;
   }
 
-  const matrix_partials_t inv_L_dbl
-      = mdivide_left_tri<Eigen::Lower>(value_of(L));
+  const matrix_partials_t L_dbl = value_of(L);
+  const auto L_lower = L_dbl.template triangularView<Eigen::Lower>();
 
   if (include_summand<propto, T_y, T_loc, T_covar_elem>::value) {
+    // one column per observation, so that the solves below are done for
+    // all observations at once
+    matrix_partials_t half(size_y, size_vec);
     for (size_t i = 0; i < size_vec; i++) {
-      vector_partials_t y_minus_mu_dbl(size_y);
       for (int j = 0; j < size_y; j++) {
-        y_minus_mu_dbl(j) = value_of(y_vec[i](j)) - value_of(mu_vec[i](j));
+        half(j, i) = value_of(y_vec[i](j)) - value_of(mu_vec[i](j));
       }
+    }
+    L_lower.solveInPlace(half);
 
-      const row_vector_partials_t half
-          = (inv_L_dbl.template triangularView<Eigen::Lower>() * y_minus_mu_dbl)
-                .transpose();
-      const vector_partials_t scaled_diff
-          = (half * inv_L_dbl.template triangularView<Eigen::Lower>())
-                .transpose();
-
-      logp -= 0.5 * dot_self(half);
+    logp -= 0.5 * half.squaredNorm();
 
-      if (!is_constant_all<T_y>::value) {
-        for (int j = 0; j < size_y; j++) {
-          ops_partials.edge1_.partials_vec_[i](j) -= scaled_diff(j);
+    if (!is_constant_all<T_y, T_loc>::value) {
+      const matrix_partials_t scaled_diff = L_lower.transpose().solve(half);
+      for (size_t i = 0; i < size_vec; i++) {
+        if (!is_constant_all<T_y>::value) {
+          for (int j = 0; j < size_y; j++) {
+            ops_partials.edge1_.partials_vec_[i](j) -= scaled_diff(j, i);
+          }
         }
-      }
-      if (!is_constant_all<T_loc>::value) {
-        for (int j = 0; j < size_y; j++) {
-          ops_partials.edge2_.partials_vec_[i](j) += scaled_diff(j);
+        if (!is_constant_all<T_loc>::value) {
+          for (int j = 0; j < size_y; j++) {
+            ops_partials.edge2_.partials_vec_[i](j) += scaled_diff(j, i);
+          }
         }
       }
-      if (!is_constant_all<T_covar>::value) {
-        ops_partials.edge3_.partials_ += scaled_diff * half;
-      }
+    }
+    if (!is_constant_all<T_covar>::value) {
+      // the partials of the quadratic form and of the log determinant are
+      // inv(L)' * (half * half' - size_vec * I)
+      matrix_partials_t half_outer = half * half.transpose();
+      half_outer.diagonal().array() -= size_vec;
+      L_lower.transpose().solveInPlace(half_outer);
+      ops_partials.edge3_.partials_ += half_outer;
     }
   }
 
   if (include_summand<propto, T_covar_elem>::value) {
-    logp += sum(log(inv_L_dbl.diagonal())) * size_vec;
-    if (!is_constant_all<T_covar>::value) {
-      ops_partials.edge3_.partials_ -= size_vec * inv_L_dbl.transpose();
-    }
+    logp -= sum(log(L_dbl.diagonal())) * size_vec;
   }
 
   return ops_partials.build(logp);
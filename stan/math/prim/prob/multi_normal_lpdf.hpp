@@ -4,28 +4,49 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/constants.hpp>
-#include <stan/math/prim/fun/log_determinant_ldlt.hpp>
+#include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/max_size_mvt.hpp>
 #include <stan/math/prim/fun/size_mvt.hpp>
-#include <stan/math/prim/fun/trace_inv_quad_form_ldlt.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
 
 namespace stan {
 namespace math {
 
+/** \ingroup multivar_dists
+ * The log of the multivariate normal density for the given y, mu, and
+ * variance matrix Sigma.
+ *
+ * The centered observations are stacked into one matrix, such that a
+ * single LDLT factorization of Sigma and a single solve serve all
+ * observations. The partials are calculated in closed form, see
+ * <code>multi_normal_cholesky_lpdf</code>.
+ *
+ * @param y A scalar vector
+ * @param mu The mean vector of the multivariate normal distribution.
+ * @param Sigma The variance matrix of the multivariate normal
+ * distribution
+ * @return The log of the multivariate normal density.
+ * @throw std::domain_error if Sigma is not square, not symmetric,
+ * or not positive definite.
+ * @tparam T_y Type of scalar.
+ * @tparam T_loc Type of location.
+ * @tparam T_covar Type of variance.
+ */
 template <bool propto, typename T_y, typename T_loc, typename T_covar>
 return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(const T_y& y,
                                                      const T_loc& mu,
                                                      const T_covar& Sigma) {
   using T_covar_elem = typename scalar_type<T_covar>::type;
-  using lp_type = return_type_t<T_y, T_loc, T_covar>;
-  using Eigen::Dynamic;
+  using T_partials_return = partials_return_t<T_y, T_loc, T_covar>;
+  using matrix_partials_t
+      = Eigen::Matrix<T_partials_return, Eigen::Dynamic, Eigen::Dynamic>;
   static const char* function = "multi_normal_lpdf";
   check_positive(function, "Covariance matrix rows", Sigma.rows());
   check_symmetric(function, "Covariance matrix", Sigma);
 
-  LDLT_factor<T_covar_elem, Dynamic, Dynamic> ldlt_Sigma(Sigma);
-  check_ldlt_factor(function, "LDLT_Factor of covariance parameter",
-                    ldlt_Sigma);
+  const Eigen::LDLT<matrix_partials_t> ldlt_Sigma(value_of(Sigma));
+  check_pos_definite(function, "covariance parameter", ldlt_Sigma);
 
   size_t number_of_y = size_mvt(y);
   size_t number_of_mu = size_mvt(mu);
@@ -34,7 +55,6 @@ return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(const T_y& y,
   }
   check_consistent_sizes_mvt(function, "y", y, "mu", mu);
 
-  lp_type lp(0.0);
   vector_seq_view<T_y> y_vec(y);
   vector_seq_view<T_loc> mu_vec(mu);
   size_t size_vec = max_size_mvt(y, mu);
@@ -43,7 +63,6 @@ return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(const T_y& y,
   int size_mu = mu_vec[0].size();
   if (size_vec > 1) {
     int size_y_old = size_y;
-    int size_y_new;
     for (size_t i = 1, size_mvt_y = size_mvt(y); i < size_mvt_y; i++) {
       int size_y_new = y_vec[i].size();
       check_size_match(function,
@@ -56,7 +75,6 @@ return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(const T_y& y,
       size_y_old = size_y_new;
     }
     int size_mu_old = size_mu;
-    int size_mu_new;
     for (size_t i = 1, size_mvt_mu = size_mvt(mu); i < size_mvt_mu; i++) {
       int size_mu_new = mu_vec[i].size();
       check_size_match(function,
@@ -68,10 +86,6 @@ return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(const T_y& y,
                        size_mu_old);
       size_mu_old = size_mu_new;
     }
-    (void)size_y_old;
-    (void)size_y_new;
-    (void)size_mu_old;
-    (void)size_mu_new;
   }
 
   check_size_match(function, "Size of random variable", size_y,
@@ -87,29 +101,62 @@ return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(const T_y& y,
   }
 
   if (size_y == 0) {
-    return lp;
+    return 0;
   }
 
+  T_partials_return logp(0);
+  operands_and_partials<T_y, T_loc, T_covar> ops_partials(y, mu, Sigma);
+
   if (include_summand<propto>::value) {
-    lp += NEG_LOG_SQRT_TWO_PI * size_y * size_vec;
+    logp += NEG_LOG_SQRT_TWO_PI * size_y * size_vec;
   }
 
   if (include_summand<propto, T_covar_elem>::value) {
-    lp -= 0.5 * log_determinant_ldlt(ldlt_Sigma) * size_vec;
+    const Eigen::Matrix<T_partials_return, Eigen::Dynamic, 1> D
+        = ldlt_Sigma.vectorD();
+    logp -= 0.5 * sum(log(D)) * size_vec;
   }
 
   if (include_summand<propto, T_y, T_loc, T_covar_elem>::value) {
-    lp_type sum_lp_vec(0.0);
+    // one column per observation, so that a single solve serves all
+    // observations
+    matrix_partials_t y_minus_mu(size_y, size_vec);
     for (size_t i = 0; i < size_vec; i++) {
-      Eigen::Matrix<return_type_t<T_y, T_loc>, Dynamic, 1> y_minus_mu(size_y);
       for (int j = 0; j < size_y; j++) {
-        y_minus_mu(j) = y_vec[i](j) - mu_vec[i](j);
+        y_minus_mu(j, i) = value_of(y_vec[i](j)) - value_of(mu_vec[i](j));
       }
-      sum_lp_vec += trace_inv_quad_form_ldlt(ldlt_Sigma, y_minus_mu);
     }
-    lp -= 0.5 * sum_lp_vec;
+    const matrix_partials_t Sigma_inv_y_minus_mu = ldlt_Sigma.solve(y_minus_mu);
+
+    logp -= 0.5 * y_minus_mu.cwiseProduct(Sigma_inv_y_minus_mu).sum();
+
+    if (!is_constant_all<T_y, T_loc>::value) {
+      for (size_t i = 0; i < size_vec; i++) {
+        if (!is_constant_all<T_y>::value) {
+          for (int j = 0; j < size_y; j++) {
+            ops_partials.edge1_.partials_vec_[i](j)
+                -= Sigma_inv_y_minus_mu(j, i);
+          }
+        }
+        if (!is_constant_all<T_loc>::value) {
+          for (int j = 0; j < size_y; j++) {
+            ops_partials.edge2_.partials_vec_[i](j)
+                += Sigma_inv_y_minus_mu(j, i);
+          }
+        }
+      }
+    }
+    if (!is_constant_all<T_covar>::value) {
+      // the partials of the quadratic form and of the log determinant are
+      // 0.5 * inv(Sigma) * (y_minus_mu * (inv(Sigma) * y_minus_mu)'
+      //                     - size_vec * I)
+      matrix_partials_t outer = y_minus_mu * Sigma_inv_y_minus_mu.transpose();
+      outer.diagonal().array() -= size_vec;
+      ops_partials.edge3_.partials_ += 0.5 * ldlt_Sigma.solve(outer);
+    }
   }
-  return lp;
+
+  return ops_partials.build(logp);
 }
 
 template <typename T_y, typename T_loc, typename T_covar>
@@ -12,60 +12,30 @@
 #include <stan/math/prim/fun/size.hpp>
 #include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/value_of_rec.hpp>
+#include <stan/math/prim/prob/glm_data.hpp>
 #include <vector>
 #include <cmath>
 
 namespace stan {
 namespace math {
 
-/** \ingroup multivar_dists
- * Returns the log PMF of the Generalized Linear Model (GLM)
- * with Negative-Binomial-2 distribution and log link function.
- * The idea is that neg_binomial_2_log_glm_lpmf(y, x, alpha, beta, phi) should
- * compute a more efficient version of
- * neg_binomial_2_log_lpmf(y, alpha + x * beta, phi) by using analytically
- * simplified gradients.
- * If containers are supplied, returns the log sum of the probabilities.
- *
- * @tparam T_y type of positive int vector of variates (labels);
- * this can also be a single positive integer value;
- * @tparam T_x_scalar type of a scalar in the matrix of independent variables
- * (features)
- * @tparam T_x_rows compile-time number of rows of `x`. It can be either
- * `Eigen::Dynamic` or 1.
- * @tparam T_alpha type of the intercept(s);
- * this can be a vector (of the same length as y) of intercepts or a single
- * value (for models with constant intercept);
- * @tparam T_beta type of the weight vector;
- * this can also be a scalar;
- * @tparam T_precision type of the (positive) precision(s);
- * this can be a vector (of the same length as y, for heteroskedasticity)
- * or a scalar.
- *
- * @param y failures count scalar or vector parameter. If it is a scalar it will
- * be broadcast - used for all instances.
- * @param x design matrix or row vector. If it is a row vector it will be
- * broadcast - used for all instances.
- * @param alpha intercept (in log odds)
- * @param beta weight vector
- * @param phi (vector of) precision parameter(s)
- * @return log probability or log sum of probabilities
- * @throw std::invalid_argument if container sizes mismatch.
- * @throw std::domain_error if x, beta or alpha is infinite.
- * @throw std::domain_error if phi is infinite or non-positive.
- * @throw std::domain_error if y is negative.
+namespace internal {
+/**
+ * Implementation of `neg_binomial_2_log_glm_lpmf()` given the sum of
+ * `lgamma(y + 1)`, which is only used if the normalizing term is included.
  */
-template <bool propto, typename T_y, typename T_x_scalar, int T_x_rows,
-          typename T_alpha, typename T_beta, typename T_precision>
-return_type_t<T_x_scalar, T_alpha, T_beta, T_precision>
-neg_binomial_2_log_glm_lpmf(
-    const T_y& y, const Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic>& x,
-    const T_alpha& alpha, const T_beta& beta, const T_precision& phi) {
+template <bool propto, typename T_y, typename T_x, typename T_alpha,
+          typename T_beta, typename T_precision>
+return_type_t<T_x, T_alpha, T_beta, T_precision> neg_binomial_2_log_glm_lpmf(
+    const T_y& y, const T_x& x, const T_alpha& alpha, const T_beta& beta,
+    const T_precision& phi, double sum_lgamma_y_plus_1) {
   using Eigen::Array;
   using Eigen::Dynamic;
   using Eigen::Matrix;
   using Eigen::exp;
   using Eigen::log1p;
+  using T_x_scalar = scalar_type_t<T_x>;
+  constexpr int T_x_rows = T_x::RowsAtCompileTime;
   using T_partials_return
       = partials_return_t<T_y, T_x_scalar, T_alpha, T_beta, T_precision>;
   using T_precision_val = typename std::conditional_t<
@@ -140,9 +110,9 @@ neg_binomial_2_log_glm_lpmf(
   // Compute the log-density.
   if (include_summand<propto>::value) {
     if (is_vector<T_y>::value) {
-      logp -= sum(lgamma(y_arr + 1));
+      logp -= sum_lgamma_y_plus_1;
     } else {
-      logp -= sum(lgamma(y_arr + 1)) * N_instances;
+      logp -= sum_lgamma_y_plus_1 * N_instances;
     }
   }
   if (include_summand<propto, T_precision>::value) {
@@ -172,9 +142,8 @@ neg_binomial_2_log_glm_lpmf(
   }
 
   // Compute the necessary derivatives.
-  operands_and_partials<Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic>,
-                        T_alpha, T_beta, T_precision>
-      ops_partials(x, alpha, beta, phi);
+  operands_and_partials<T_x, T_alpha, T_beta, T_precision> ops_partials(
+      x, alpha, beta, phi);
   if (!is_constant_all<T_x_scalar, T_beta, T_alpha, T_precision>::value) {
     Array<T_partials_return, Dynamic, 1> theta_exp = theta.exp();
     if (!is_constant_all<T_x_scalar, T_beta, T_alpha>::value) {
@@ -224,6 +193,86 @@ neg_binomial_2_log_glm_lpmf(
   return ops_partials.build(logp);
 }
 
+}  // namespace internal
+
+/** \ingroup multivar_dists
+ * Returns the log PMF of the Generalized Linear Model (GLM)
+ * with Negative-Binomial-2 distribution and log link function.
+ * The idea is that neg_binomial_2_log_glm_lpmf(y, x, alpha, beta, phi) should
+ * compute a more efficient version of
+ * neg_binomial_2_log_lpmf(y, alpha + x * beta, phi) by using analytically
+ * simplified gradients.
+ * If containers are supplied, returns the log sum of the probabilities.
+ *
+ * @tparam T_y type of positive int vector of variates (labels);
+ * this can also be a single positive integer value;
+ * @tparam T_x type of the matrix of independent variables (features). It
+ * can be an `Eigen::Matrix` with either `Eigen::Dynamic` or 1 compile-time
+ * rows, or an `Eigen::SparseMatrix<double>` of data.
+ * @tparam T_alpha type of the intercept(s);
+ * this can be a vector (of the same length as y) of intercepts or a single
+ * value (for models with constant intercept);
+ * @tparam T_beta type of the weight vector;
+ * this can also be a scalar;
+ * @tparam T_precision type of the (positive) precision(s);
+ * this can be a vector (of the same length as y, for heteroskedasticity)
+ * or a scalar.
+ *
+ * @param y failures count scalar or vector parameter. If it is a scalar it will
+ * be broadcast - used for all instances.
+ * @param x design matrix or row vector. If it is a row vector it will be
+ * broadcast - used for all instances.
+ * @param alpha intercept (in log odds)
+ * @param beta weight vector
+ * @param phi (vector of) precision parameter(s)
+ * @return log probability or log sum of probabilities
+ * @throw std::invalid_argument if container sizes mismatch.
+ * @throw std::domain_error if x, beta or alpha is infinite.
+ * @throw std::domain_error if phi is infinite or non-positive.
+ * @throw std::domain_error if y is negative.
+ */
+template <bool propto, typename T_y, typename T_x, typename T_alpha,
+          typename T_beta, typename T_precision,
+          require_eigen_t<T_x>* = nullptr>
+inline return_type_t<T_x, T_alpha, T_beta, T_precision>
+neg_binomial_2_log_glm_lpmf(const T_y& y, const T_x& x, const T_alpha& alpha,
+                            const T_beta& beta, const T_precision& phi) {
+  return internal::neg_binomial_2_log_glm_lpmf<propto>(
+      y, x, alpha, beta, phi,
+      include_summand<propto>::value ? internal::sum_lgamma_plus_1(y) : 0);
+}
+
+/** \ingroup multivar_dists
+ * Returns the log PMF of the Negative-Binomial-2 GLM with log link function
+ * for the dependent and independent variables in `data`, reusing its
+ * precomputed normalizing term.
+ *
+ * @tparam T_y type of positive int vector of variates (labels);
+ * this can also be a single positive integer value;
+ * @tparam T_x type of the matrix of independent variables (features)
+ * @tparam T_alpha type of the intercept(s)
+ * @tparam T_beta type of the weight vector
+ * @tparam T_precision type of the (positive) precision(s)
+ * @param data dependent and independent variables
+ * @param alpha intercept (in log odds)
+ * @param beta weight vector
+ * @param phi (vector of) precision parameter(s)
+ * @return log probability or log sum of probabilities
+ * @throw std::invalid_argument if container sizes mismatch.
+ * @throw std::domain_error if x, beta or alpha is infinite.
+ * @throw std::domain_error if phi is infinite or non-positive.
+ * @throw std::domain_error if y is negative.
+ */
+template <bool propto, typename T_y, typename T_x, typename T_alpha,
+          typename T_beta, typename T_precision>
+inline return_type_t<T_x, T_alpha, T_beta, T_precision>
+neg_binomial_2_log_glm_lpmf(const glm_data<T_y, T_x>& data,
+                            const T_alpha& alpha, const T_beta& beta,
+                            const T_precision& phi) {
+  return internal::neg_binomial_2_log_glm_lpmf<propto>(
+      data.y(), data.x(), alpha, beta, phi, data.sum_lgamma_y_plus_1());
+}
+
 template <typename T_y, typename T_x, typename T_alpha, typename T_beta,
           typename T_precision>
 inline return_type_t<T_x, T_alpha, T_beta, T_precision>
@@ -231,6 +280,15 @@ neg_binomial_2_log_glm_lpmf(const T_y& y, const T_x& x, const T_alpha& alpha,
                             const T_beta& beta, const T_precision& phi) {
   return neg_binomial_2_log_glm_lpmf<false>(y, x, alpha, beta, phi);
 }
+
+template <typename T_y, typename T_x, typename T_alpha, typename T_beta,
+          typename T_precision>
+inline return_type_t<T_x, T_alpha, T_beta, T_precision>
+neg_binomial_2_log_glm_lpmf(const glm_data<T_y, T_x>& data,
+                            const T_alpha& alpha, const T_beta& beta,
+                            const T_precision& phi) {
+  return neg_binomial_2_log_glm_lpmf<false>(data, alpha, beta, phi);
+}
 }  // namespace math
 }  // namespace stan
 #endif
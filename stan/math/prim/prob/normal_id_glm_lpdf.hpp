@@ -23,10 +23,9 @@ namespace math {
  * by using analytically simplified gradients.
  *
  * @tparam T_y type of vector of dependent variables (labels);
- * @tparam T_x_scalar type of a scalar in the matrix of independent variables
- * (features)
- * @tparam T_x_rows compile-time number of rows of `x`. It can be either
- * `Eigen::Dynamic` or 1.
+ * @tparam T_x type of the matrix of independent variables (features). It
+ * can be an `Eigen::Matrix` with either `Eigen::Dynamic` or 1 compile-time
+ * rows, or an `Eigen::SparseMatrix<double>` of data.
  * @tparam T_alpha type of the intercept(s);
  * this can be a vector (of the same length as y) of intercepts or a single
  * value (for models with constant intercept);
@@ -49,15 +48,17 @@ namespace math {
  * @throw std::domain_error if the scale is not positive.
  * @throw std::invalid_argument if container sizes mismatch.
  */
-template <bool propto, typename T_y, typename T_x_scalar, int T_x_rows,
-          typename T_alpha, typename T_beta, typename T_scale>
-return_type_t<T_y, T_x_scalar, T_alpha, T_beta, T_scale> normal_id_glm_lpdf(
-    const T_y &y, const Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic> &x,
-    const T_alpha &alpha, const T_beta &beta, const T_scale &sigma) {
+template <bool propto, typename T_y, typename T_x, typename T_alpha,
+          typename T_beta, typename T_scale, require_eigen_t<T_x>* = nullptr>
+return_type_t<T_y, T_x, T_alpha, T_beta, T_scale> normal_id_glm_lpdf(
+    const T_y &y, const T_x &x, const T_alpha &alpha, const T_beta &beta,
+    const T_scale &sigma) {
   using Eigen::Array;
   using Eigen::Dynamic;
   using Eigen::Matrix;
   using Eigen::VectorXd;
+  using T_x_scalar = scalar_type_t<T_x>;
+  constexpr int T_x_rows = T_x::RowsAtCompileTime;
   using T_partials_return
       = partials_return_t<T_y, T_x_scalar, T_alpha, T_beta, T_scale>;
   using T_scale_val = typename std::conditional_t<
@@ -118,9 +119,8 @@ return_type_t<T_y, T_x_scalar, T_alpha, T_beta, T_scale> normal_id_glm_lpdf(
                * inv_sigma;
   }
 
-  operands_and_partials<T_y, Matrix<T_x_scalar, T_x_rows, Dynamic>, T_alpha,
-                        T_beta, T_scale>
-      ops_partials(y, x, alpha, beta, sigma);
+  operands_and_partials<T_y, T_x, T_alpha, T_beta, T_scale> ops_partials(
+      y, x, alpha, beta, sigma);
 
   if (!(is_constant_all<T_y, T_x_scalar, T_beta, T_alpha>::value)) {
     Matrix<T_partials_return, Dynamic, 1> mu_derivative = inv_sigma * y_scaled;
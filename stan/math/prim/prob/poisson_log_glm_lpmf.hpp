@@ -9,50 +9,28 @@
 #include <stan/math/prim/fun/size.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/value_of_rec.hpp>
+#include <stan/math/prim/prob/glm_data.hpp>
 #include <cmath>
 
 namespace stan {
 namespace math {
 
-/** \ingroup multivar_dists
- * Returns the log PMF of the Generalized Linear Model (GLM)
- * with Poisson distribution and log link function.
- * The idea is that poisson_log_glm_lpmf(y, x, alpha, beta) should
- * compute a more efficient version of poisson_log_lpmf(y, alpha + x * beta)
- * by using analytically simplified gradients.
- * If containers are supplied, returns the log sum of the probabilities.
- *
- * @tparam T_y type of vector of variates (labels), integers >=0;
- * this can also be a single positive integer;
- * @tparam T_x_scalar type of a scalar in the matrix of independent variables
- * (features)
- * @tparam T_x_rows compile-time number of rows of `x`. It can be either
- * `Eigen::Dynamic` or 1.
- * @tparam T_alpha type of the intercept(s);
- * this can be a vector (of the same length as y) of intercepts or a single
- * value (for models with constant intercept);
- * @tparam T_beta type of the weight vector;
- * this can also be a single value;
- * @param y positive integer scalar or vector parameter. If it is a scalar it
- * will be broadcast - used for all instances.
- * @param x design matrix or row vector. If it is a row vector it will be
- * broadcast - used for all instances.
- * @param alpha intercept (in log odds)
- * @param beta weight vector
- * @return log probability or log sum of probabilities
- * @throw std::domain_error if x, beta or alpha is infinite.
- * @throw std::domain_error if y is negative.
- * @throw std::invalid_argument if container sizes mismatch.
+namespace internal {
+/**
+ * Implementation of `poisson_log_glm_lpmf()` given the sum of
+ * `lgamma(y + 1)`, which is only used if the normalizing term is included.
  */
-template <bool propto, typename T_y, typename T_x_scalar, int T_x_rows,
-          typename T_alpha, typename T_beta>
-return_type_t<T_x_scalar, T_alpha, T_beta> poisson_log_glm_lpmf(
-    const T_y& y, const Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic>& x,
-    const T_alpha& alpha, const T_beta& beta) {
+template <bool propto, typename T_y, typename T_x, typename T_alpha,
+          typename T_beta>
+return_type_t<T_x, T_alpha, T_beta> poisson_log_glm_lpmf(
+    const T_y& y, const T_x& x, const T_alpha& alpha, const T_beta& beta,
+    double sum_lgamma_y_plus_1) {
   using Eigen::Array;
   using Eigen::Dynamic;
   using Eigen::Matrix;
   using std::exp;
+  using T_x_scalar = scalar_type_t<T_x>;
+  constexpr int T_x_rows = T_x::RowsAtCompileTime;
   using T_partials_return = partials_return_t<T_y, T_x_scalar, T_alpha, T_beta>;
   using T_alpha_val = typename std::conditional_t<
       is_vector<T_alpha>::value,
@@ -110,19 +88,13 @@ return_type_t<T_x_scalar, T_alpha, T_beta> poisson_log_glm_lpmf(
     check_finite(function, "Matrix of independent variables", theta);
   }
   if (include_summand<propto>::value) {
-    if (is_vector<T_y>::value) {
-      logp -= sum(lgamma(as_array_or_scalar(y_val_vec) + 1));
-    } else {
-      logp -= lgamma(forward_as<double>(y_val) + 1);
-    }
+    logp -= sum_lgamma_y_plus_1;
   }
 
   logp += sum(as_array_or_scalar(y_val_vec) * theta.array()
               - exp(theta.array()));
 
-  operands_and_partials<Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic>,
-                        T_alpha, T_beta>
-      ops_partials(x, alpha, beta);
+  operands_and_partials<T_x, T_alpha, T_beta> ops_partials(x, alpha, beta);
   // Compute the necessary derivatives.
   if (!is_constant_all<T_beta>::value) {
     if (T_x_rows == 1) {
@@ -153,12 +125,86 @@ return_type_t<T_x_scalar, T_alpha, T_beta> poisson_log_glm_lpmf(
   return ops_partials.build(logp);
 }
 
+}  // namespace internal
+
+/** \ingroup multivar_dists
+ * Returns the log PMF of the Generalized Linear Model (GLM)
+ * with Poisson distribution and log link function.
+ * The idea is that poisson_log_glm_lpmf(y, x, alpha, beta) should
+ * compute a more efficient version of poisson_log_lpmf(y, alpha + x * beta)
+ * by using analytically simplified gradients.
+ * If containers are supplied, returns the log sum of the probabilities.
+ *
+ * @tparam T_y type of vector of variates (labels), integers >=0;
+ * this can also be a single positive integer;
+ * @tparam T_x type of the matrix of independent variables (features). It
+ * can be an `Eigen::Matrix` with either `Eigen::Dynamic` or 1 compile-time
+ * rows, or an `Eigen::SparseMatrix<double>` of data.
+ * @tparam T_alpha type of the intercept(s);
+ * this can be a vector (of the same length as y) of intercepts or a single
+ * value (for models with constant intercept);
+ * @tparam T_beta type of the weight vector;
+ * this can also be a single value;
+ * @param y positive integer scalar or vector parameter. If it is a scalar it
+ * will be broadcast - used for all instances.
+ * @param x design matrix or row vector. If it is a row vector it will be
+ * broadcast - used for all instances.
+ * @param alpha intercept (in log odds)
+ * @param beta weight vector
+ * @return log probability or log sum of probabilities
+ * @throw std::domain_error if x, beta or alpha is infinite.
+ * @throw std::domain_error if y is negative.
+ * @throw std::invalid_argument if container sizes mismatch.
+ */
+template <bool propto, typename T_y, typename T_x, typename T_alpha,
+          typename T_beta, require_eigen_t<T_x>* = nullptr>
+inline return_type_t<T_x, T_alpha, T_beta> poisson_log_glm_lpmf(
+    const T_y& y, const T_x& x, const T_alpha& alpha, const T_beta& beta) {
+  return internal::poisson_log_glm_lpmf<propto>(
+      y, x, alpha, beta,
+      include_summand<propto>::value ? internal::sum_lgamma_plus_1(y) : 0);
+}
+
+/** \ingroup multivar_dists
+ * Returns the log PMF of the Poisson GLM with log link function for the
+ * dependent and independent variables in `data`, reusing its precomputed
+ * normalizing term.
+ *
+ * @tparam T_y type of vector of variates (labels), integers >=0;
+ * this can also be a single positive integer;
+ * @tparam T_x type of the matrix of independent variables (features)
+ * @tparam T_alpha type of the intercept(s)
+ * @tparam T_beta type of the weight vector
+ * @param data dependent and independent variables
+ * @param alpha intercept (in log odds)
+ * @param beta weight vector
+ * @return log probability or log sum of probabilities
+ * @throw std::domain_error if x, beta or alpha is infinite.
+ * @throw std::domain_error if y is negative.
+ * @throw std::invalid_argument if container sizes mismatch.
+ */
+template <bool propto, typename T_y, typename T_x, typename T_alpha,
+          typename T_beta>
+inline return_type_t<T_x, T_alpha, T_beta> poisson_log_glm_lpmf(
+    const glm_data<T_y, T_x>& data, const T_alpha& alpha,
+    const T_beta& beta) {
+  return internal::poisson_log_glm_lpmf<propto>(
+      data.y(), data.x(), alpha, beta, data.sum_lgamma_y_plus_1());
+}
+
 template <typename T_y, typename T_x, typename T_alpha, typename T_beta>
 inline return_type_t<T_x, T_alpha, T_beta> poisson_log_glm_lpmf(
     const T_y& y, const T_x& x, const T_alpha& alpha, const T_beta& beta) {
   return poisson_log_glm_lpmf<false>(y, x, alpha, beta);
 }
 
+template <typename T_y, typename T_x, typename T_alpha, typename T_beta>
+inline return_type_t<T_x, T_alpha, T_beta> poisson_log_glm_lpmf(
+    const glm_data<T_y, T_x>& data, const T_alpha& alpha,
+    const T_beta& beta) {
+  return poisson_log_glm_lpmf<false>(data, alpha, beta);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,151 @@
+#ifndef STAN_MATH_REV_CORE_ARENA_MATRIX_HPP
+#define STAN_MATH_REV_CORE_ARENA_MATRIX_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/rev/core/chainablestack.hpp>
+#include <new>
+
+namespace stan {
+namespace math {
+
+/**
+ * Equivalent to an <code>Eigen::Matrix</code>, except that the data is
+ * stored on the autodiff arena. The memory is released on calls to
+ * <code>recover_memory()</code> and no destructor needs to run, hence
+ * arena matrices can be members of varis and do not perform any heap
+ * allocations.
+ *
+ * Copying an arena matrix is shallow: the copy refers to the same
+ * data. Assigning any other Eigen expression allocates a new buffer
+ * of the size of the expression on the arena and evaluates the
+ * expression into it. Compound assignments such as <code>+=</code>
+ * and assignments to blocks operate on the existing buffer.
+ *
+ * @tparam MatrixType type of the plain Eigen matrix this is
+ * equivalent to
+ */
+template <typename MatrixType>
+class arena_matrix : public Eigen::Map<MatrixType> {
+ public:
+  using Scalar = value_type_t<MatrixType>;
+  using Base = Eigen::Map<MatrixType>;
+  using PlainObject = std::decay_t<MatrixType>;
+  static constexpr int RowsAtCompileTime = MatrixType::RowsAtCompileTime;
+  static constexpr int ColsAtCompileTime = MatrixType::ColsAtCompileTime;
+
+  /**
+   * Default constructor. Creates an empty matrix, or a matrix of the
+   * compile time size of <code>MatrixType</code> pointing to no data.
+   */
+  arena_matrix()
+      : Base::Map(nullptr,
+                  RowsAtCompileTime == Eigen::Dynamic ? 0 : RowsAtCompileTime,
+                  ColsAtCompileTime == Eigen::Dynamic ? 0
+                                                      : ColsAtCompileTime) {}
+
+  /**
+   * Constructs an uninitialized arena matrix of the given size.
+   *
+   * @param rows number of rows
+   * @param cols number of columns
+   */
+  arena_matrix(Eigen::Index rows, Eigen::Index cols)
+      : Base::Map(
+            ChainableStack::instance_->memalloc_.alloc_array<Scalar>(rows
+                                                                     * cols),
+            rows, cols) {}
+
+  /**
+   * Constructs an uninitialized arena vector or row vector of the given
+   * size.
+   *
+   * @param size number of elements
+   */
+  explicit arena_matrix(Eigen::Index size)
+      : Base::Map(
+            ChainableStack::instance_->memalloc_.alloc_array<Scalar>(size),
+            size) {}
+
+  /**
+   * Constructs an arena matrix from an Eigen expression, which is
+   * evaluated into a new buffer on the arena. A row vector expression
+   * may initialize a column vector and vice versa.
+   *
+   * @tparam T type of the expression
+   * @param other expression to evaluate
+   */
+  template <typename T, require_eigen_t<T>* = nullptr>
+  arena_matrix(const T& other)  // NOLINT(runtime/explicit)
+      : Base::Map(
+            ChainableStack::instance_->memalloc_.alloc_array<Scalar>(
+                other.size()),
+            (RowsAtCompileTime == 1 && T::ColsAtCompileTime == 1)
+                    || (ColsAtCompileTime == 1 && T::RowsAtCompileTime == 1)
+                ? other.cols()
+                : other.rows(),
+            (RowsAtCompileTime == 1 && T::ColsAtCompileTime == 1)
+                    || (ColsAtCompileTime == 1 && T::RowsAtCompileTime == 1)
+                ? other.rows()
+                : other.cols()) {
+    Base::operator=(other);
+  }
+
+  /**
+   * Shallow copy constructor. The new object refers to the same data.
+   *
+   * @param other arena matrix to refer to
+   */
+  arena_matrix(const arena_matrix<MatrixType>& other)
+      : Base::Map(const_cast<Scalar*>(other.data()), other.rows(),
+                  other.cols()) {}
+
+  using Base::operator=;
+
+  /**
+   * Shallow copy assignment. After the assignment this object refers to
+   * the data of <code>other</code>.
+   *
+   * @param other arena matrix to refer to
+   * @return <code>*this</code>
+   */
+  arena_matrix& operator=(const arena_matrix<MatrixType>& other) {
+    // placement new changes what data map points to - there is no
+    // allocation
+    new (this)
+        Base(const_cast<Scalar*>(other.data()), other.rows(), other.cols());
+    return *this;
+  }
+
+  /**
+   * Assignment of an Eigen expression. A new buffer of the size of the
+   * expression is allocated on the arena and the expression is
+   * evaluated into it.
+   *
+   * @tparam T type of the expression
+   * @param a expression to evaluate
+   * @return <code>*this</code>
+   */
+  template <typename T>
+  arena_matrix& operator=(const T& a) {
+    // placement new changes what data map points to - the new buffer
+    // is allocated on the arena
+    new (this) Base(
+        ChainableStack::instance_->memalloc_.alloc_array<Scalar>(a.size()),
+        (RowsAtCompileTime == 1 && T::ColsAtCompileTime == 1)
+                || (ColsAtCompileTime == 1 && T::RowsAtCompileTime == 1)
+            ? a.cols()
+            : a.rows(),
+        (RowsAtCompileTime == 1 && T::ColsAtCompileTime == 1)
+                || (ColsAtCompileTime == 1 && T::RowsAtCompileTime == 1)
+            ? a.rows()
+            : a.cols());
+    Base::operator=(a);
+    return *this;
+  }
+};
+
+}  // namespace math
+}  // namespace stan
+
+#endif
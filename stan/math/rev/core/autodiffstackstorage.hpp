@@ -1,8 +1,15 @@
 #ifndef STAN_MATH_REV_CORE_AUTODIFFSTACKSTORAGE_HPP
 #define STAN_MATH_REV_CORE_AUTODIFFSTACKSTORAGE_HPP
 
+#include <stan/math/memory/chunked_stack.hpp>
 #include <stan/math/memory/stack_alloc.hpp>
+#include <utility>
 #include <vector>
+#ifdef STAN_AD_PROFILE
+#include <stan/math/rev/core/profile_info.hpp>
+#include <map>
+#include <string>
+#endif
 
 namespace stan {
 namespace math {
@@ -101,15 +108,36 @@ struct AutodiffStackSingleton {
   struct AutodiffStackStorage {
     AutodiffStackStorage &operator=(const AutodiffStackStorage &) = delete;
 
-    std::vector<ChainableT *> var_stack_;
-    std::vector<ChainableT *> var_nochain_stack_;
+    chunked_stack<ChainableT *> var_stack_;
+    chunked_stack<ChainableT *> var_nochain_stack_;
     std::vector<ChainableAllocT *> var_alloc_stack_;
     stack_alloc memalloc_;
+    // adjoints of matrix varis, which set_zero_adjoint() does not reset
+    std::vector<std::pair<double *, size_t>> var_matrix_adj_stack_;
 
     // nested positions
     std::vector<size_t> nested_var_stack_sizes_;
     std::vector<size_t> nested_var_nochain_stack_sizes_;
     std::vector<size_t> nested_var_alloc_stack_starts_;
+    std::vector<size_t> nested_var_matrix_adj_stack_sizes_;
+
+#ifdef STAN_AD_PROFILE
+    // costs per profiled function, the empty name collects the varis
+    // created outside of any profiled function
+    std::map<std::string, profile_info> profile_;
+    // profiled functions being called, innermost last
+    std::vector<internal::profile_frame> profile_frames_;
+    // profiled function of each entry of var_stack_
+    chunked_stack<profile_info *> var_stack_profile_;
+    profile_info *profile_current_ = nullptr;
+
+    inline profile_info *profile_current() {
+      if (profile_current_ == nullptr) {
+        profile_current_ = &profile_[std::string()];
+      }
+      return profile_current_;
+    }
+#endif
   };
 
   explicit AutodiffStackSingleton(AutodiffStackSingleton_t const &) = delete;
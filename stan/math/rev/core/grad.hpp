@@ -6,7 +6,9 @@
 #include <stan/math/rev/core/empty_nested.hpp>
 #include <stan/math/rev/core/nested_size.hpp>
 #include <stan/math/rev/core/vari.hpp>
-#include <vector>
+#ifdef STAN_AD_PROFILE
+#include <chrono>
+#endif
 
 namespace stan {
 namespace math {
@@ -24,25 +26,46 @@ namespace math {
  *
  * <p>This function does not recover any memory from the computation.
  *
+ * <p>If STAN_AD_PROFILE is defined, the time spent in the
+ * <code>chain()</code> methods is recorded for the profiled functions
+ * which created the varis, see <code>profile_scope</code>.
+ *
  * @param vi Variable implementation for root of partial
  * derivative propagation.
  */
 static void grad(vari* vi) {
-  // simple reference implementation (intended as doc):
-  //   vi->init_dependent();
-  //   size_t end = var_stack_.size();
-  //   size_t begin = empty_nested() ? 0 : end - nested_size();
-  //   for (size_t i = end; --i > begin; )
-  //     var_stack_[i]->chain();
-
-  using it_t = std::vector<vari*>::reverse_iterator;
+  // The stack is walked chunk by chunk. A chain() method may itself run
+  // a nested autodiff sweep, which pushes to the var stack before
+  // recovering it again; the chunks never relocate, so this is safe.
   vi->init_dependent();
-  it_t begin = ChainableStack::instance_->var_stack_.rbegin();
-  it_t end = empty_nested() ? ChainableStack::instance_->var_stack_.rend()
-                            : begin + nested_size();
-  for (it_t it = begin; it < end; ++it) {
-    (*it)->chain();
+  auto& var_stack = ChainableStack::instance_->var_stack_;
+  const size_t end = var_stack.size();
+  const size_t begin = empty_nested() ? 0 : end - nested_size();
+#ifdef STAN_AD_PROFILE
+  // consecutive varis of the same profiled function are timed together
+  auto& var_stack_profile = ChainableStack::instance_->var_stack_profile_;
+  profile_info* profile = nullptr;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = end; i > begin; --i) {
+    if (var_stack_profile[i - 1] != profile) {
+      const auto now = std::chrono::steady_clock::now();
+      if (profile != nullptr) {
+        profile->chain_time_
+            += std::chrono::duration<double>(now - start).count();
+      }
+      profile = var_stack_profile[i - 1];
+      start = now;
+    }
+    var_stack[i - 1]->chain();
   }
+  if (profile != nullptr) {
+    profile->chain_time_ += std::chrono::duration<double>(
+                                std::chrono::steady_clock::now() - start)
+                                .count();
+  }
+#else
+  var_stack.for_each_reverse(begin, end, [](vari* x) { x->chain(); });
+#endif
 }
 
 }  // namespace math
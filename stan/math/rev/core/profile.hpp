@@ -0,0 +1,159 @@
+#ifndef STAN_MATH_REV_CORE_PROFILE_HPP
+#define STAN_MATH_REV_CORE_PROFILE_HPP
+
+#include <stan/math/rev/core/chainablestack.hpp>
+#include <stan/math/rev/core/profile_info.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Attributes the costs of the autodiff stack to a function for the
+ * lifetime of the object, if STAN_AD_PROFILE is defined. Otherwise
+ * the object is empty and compiles away.
+ *
+ * A profiled function creates a <code>profile_scope</code> on entry.
+ * Until it returns, the varis created and the arena memory allocated
+ * are counted for the function and the time spent is recorded as its
+ * forward time. The <code>chain()</code> times of its varis are
+ * recorded in later calls to <code>grad()</code>. Profiled functions
+ * may call each other; the costs are attributed to the innermost one.
+ *
+ * The profiled costs are kept per thread. Profiling is meant for
+ * finding where the time of a gradient is spent and it slows down
+ * the creation and the chaining of every vari.
+ */
+class profile_scope {
+ public:
+#ifdef STAN_AD_PROFILE
+  /**
+   * Start attributing costs to the named function.
+   *
+   * @param name name of the profiled function
+   */
+  explicit profile_scope(const char* name) {
+    auto* stack = ChainableStack::instance_;
+    profile_info* info = &stack->profile_[name];
+    stack->profile_frames_.push_back({info, std::chrono::steady_clock::now(),
+                                      stack->memalloc_.bytes_in_use(), 0.0,
+                                      0});
+    stack->profile_current_ = info;
+  }
+
+  /**
+   * Stop attributing costs to the function, and add its costs
+   * exclusive of the profiled functions it called.
+   */
+  ~profile_scope() {
+    auto* stack = ChainableStack::instance_;
+    const internal::profile_frame frame = stack->profile_frames_.back();
+    stack->profile_frames_.pop_back();
+    const double time = std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - frame.start_)
+                            .count();
+    // memory recovered within the function is not counted
+    const size_t bytes_in_use = stack->memalloc_.bytes_in_use();
+    const size_t bytes = bytes_in_use > frame.start_bytes_
+                             ? bytes_in_use - frame.start_bytes_
+                             : 0;
+    ++frame.info_->calls_;
+    frame.info_->forward_time_ += time - frame.child_time_;
+    frame.info_->arena_bytes_ += bytes - std::min(bytes, frame.child_bytes_);
+    if (stack->profile_frames_.empty()) {
+      stack->profile_current_ = nullptr;
+    } else {
+      stack->profile_frames_.back().child_time_ += time;
+      stack->profile_frames_.back().child_bytes_ += bytes;
+      stack->profile_current_ = stack->profile_frames_.back().info_;
+    }
+  }
+#else
+  explicit profile_scope(const char* name) {}
+#endif
+
+  profile_scope(const profile_scope&) = delete;
+  profile_scope& operator=(const profile_scope&) = delete;
+};
+
+/**
+ * Return the costs of the profiled functions of the calling thread
+ * since the first profiled call or the last call to
+ * <code>reset_profile()</code>. The entry with the empty name holds
+ * the varis created outside of profiled functions and their
+ * <code>chain()</code> time. Without STAN_AD_PROFILE nothing is
+ * profiled and the result is empty.
+ *
+ * @return costs by name of the profiled function
+ */
+inline std::map<std::string, profile_info> profile_results() {
+#ifdef STAN_AD_PROFILE
+  std::map<std::string, profile_info> results;
+  for (const auto& entry : ChainableStack::instance_->profile_) {
+    const profile_info& info = entry.second;
+    if (info.calls_ > 0 || info.chain_varis_ > 0 || info.nochain_varis_ > 0
+        || info.chain_time_ > 0) {
+      results.insert(entry);
+    }
+  }
+  return results;
+#else
+  return {};
+#endif
+}
+
+/**
+ * Set the profiled costs of the calling thread to zero.
+ */
+inline void reset_profile() {
+#ifdef STAN_AD_PROFILE
+  // the entries stay in place, as the stack may still point to them
+  for (auto& entry : ChainableStack::instance_->profile_) {
+    entry.second = profile_info();
+  }
+#endif
+}
+
+/**
+ * Print the profiled costs of the calling thread, one line per
+ * function, sorted by decreasing total of forward and
+ * <code>chain()</code> time.
+ *
+ * @param o stream to print to
+ */
+inline void print_profile(std::ostream& o) {
+  std::vector<std::pair<std::string, profile_info>> results;
+  for (const auto& entry : profile_results()) {
+    results.push_back(entry);
+  }
+  std::stable_sort(results.begin(), results.end(),
+                   [](const auto& a, const auto& b) {
+                     return a.second.forward_time_ + a.second.chain_time_
+                            > b.second.forward_time_ + b.second.chain_time_;
+                   });
+  o << std::left << std::setw(32) << "function" << std::right
+    << std::setw(10) << "calls" << std::setw(12) << "varis"
+    << std::setw(12) << "nochain" << std::setw(14) << "arena bytes"
+    << std::setw(14) << "forward s" << std::setw(14) << "chain s"
+    << std::endl;
+  for (const auto& entry : results) {
+    const profile_info& info = entry.second;
+    o << std::left << std::setw(32)
+      << (entry.first.empty() ? "(not profiled)" : entry.first) << std::right
+      << std::setw(10) << info.calls_ << std::setw(12) << info.chain_varis_
+      << std::setw(12) << info.nochain_varis_ << std::setw(14)
+      << info.arena_bytes_ << std::setw(14) << info.forward_time_
+      << std::setw(14) << info.chain_time_ << std::endl;
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
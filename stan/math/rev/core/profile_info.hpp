@@ -0,0 +1,62 @@
+#ifndef STAN_MATH_REV_CORE_PROFILE_INFO_HPP
+#define STAN_MATH_REV_CORE_PROFILE_INFO_HPP
+
+#include <chrono>
+#include <cstddef>
+
+namespace stan {
+namespace math {
+
+/**
+ * Costs of the autodiff stack attributed to one profiled function,
+ * recorded if STAN_AD_PROFILE is defined.
+ *
+ * The costs of a function exclude those of profiled functions it
+ * calls, such that the costs of all profiled functions add up to the
+ * cost of the whole gradient.
+ */
+struct profile_info {
+  /**
+   * Number of times the profiled function was called.
+   */
+  size_t calls_ = 0;
+  /**
+   * Number of varis put on the stack of varis to chain.
+   */
+  size_t chain_varis_ = 0;
+  /**
+   * Number of varis put on the stack of varis not to chain.
+   */
+  size_t nochain_varis_ = 0;
+  /**
+   * Number of bytes allocated on the arena.
+   */
+  size_t arena_bytes_ = 0;
+  /**
+   * Time in seconds spent in the function, which includes creating
+   * the varis.
+   */
+  double forward_time_ = 0;
+  /**
+   * Time in seconds spent in the <code>chain()</code> methods of the
+   * varis created by the function.
+   */
+  double chain_time_ = 0;
+};
+
+namespace internal {
+/**
+ * A call of a profiled function which has not returned yet.
+ */
+struct profile_frame {
+  profile_info* info_;
+  std::chrono::steady_clock::time_point start_;
+  size_t start_bytes_;
+  double child_time_;
+  size_t child_bytes_;
+};
+}  // namespace internal
+
+}  // namespace math
+}  // namespace stan
+#endif
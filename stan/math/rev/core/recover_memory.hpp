@@ -22,7 +22,11 @@ static inline void recover_memory() {
         " before calling recover_memory()");
   }
   ChainableStack::instance_->var_stack_.clear();
+#ifdef STAN_AD_PROFILE
+  ChainableStack::instance_->var_stack_profile_.clear();
+#endif
   ChainableStack::instance_->var_nochain_stack_.clear();
+  ChainableStack::instance_->var_matrix_adj_stack_.clear();
   for (auto &x : ChainableStack::instance_->var_alloc_stack_) {
     delete x;
   }
@@ -29,12 +29,20 @@ static inline void recover_memory_nested() {
 
   ChainableStack::instance_->var_stack_.resize(
       ChainableStack::instance_->nested_var_stack_sizes_.back());
+#ifdef STAN_AD_PROFILE
+  ChainableStack::instance_->var_stack_profile_.resize(
+      ChainableStack::instance_->nested_var_stack_sizes_.back());
+#endif
   ChainableStack::instance_->nested_var_stack_sizes_.pop_back();
 
   ChainableStack::instance_->var_nochain_stack_.resize(
       ChainableStack::instance_->nested_var_nochain_stack_sizes_.back());
   ChainableStack::instance_->nested_var_nochain_stack_sizes_.pop_back();
 
+  ChainableStack::instance_->var_matrix_adj_stack_.resize(
+      ChainableStack::instance_->nested_var_matrix_adj_stack_sizes_.back());
+  ChainableStack::instance_->nested_var_matrix_adj_stack_sizes_.pop_back();
+
   for (size_t i
        = ChainableStack::instance_->nested_var_alloc_stack_starts_.back();
        i < ChainableStack::instance_->var_alloc_stack_.size(); ++i) {
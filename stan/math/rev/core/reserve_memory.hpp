@@ -0,0 +1,71 @@
+#ifndef STAN_MATH_REV_CORE_RESERVE_MEMORY_HPP
+#define STAN_MATH_REV_CORE_RESERVE_MEMORY_HPP
+
+#include <stan/math/rev/core/chainablestack.hpp>
+#include <cstddef>
+
+namespace stan {
+namespace math {
+
+/**
+ * Sizes of the memory used by the autodiff stack.
+ */
+struct autodiff_memory_size {
+  /**
+   * Number of bytes of the arena.
+   */
+  size_t arena_bytes;
+  /**
+   * Number of entries of the stack of varis to chain.
+   */
+  size_t var_stack_size;
+  /**
+   * Number of entries of the stack of varis not to chain.
+   */
+  size_t var_nochain_stack_size;
+};
+
+/**
+ * Return the largest amount of memory the autodiff stack of the
+ * calling thread has needed so far. The sizes of the arena and of the
+ * var stacks are recorded when memory is recovered, so this covers all
+ * gradients up to the last call to <code>recover_memory()</code> or
+ * <code>recover_memory_nested()</code>.
+ *
+ * @return high-water mark of the autodiff memory
+ */
+static inline autodiff_memory_size memory_high_water_mark() {
+  return {ChainableStack::instance_->memalloc_.high_water_mark(),
+          ChainableStack::instance_->var_stack_.high_water_mark(),
+          ChainableStack::instance_->var_nochain_stack_.high_water_mark()};
+}
+
+/**
+ * Reserve memory for the autodiff stack of the calling thread, so that
+ * gradients using up to the specified amount of memory do not allocate
+ * memory from the system.
+ *
+ * The arena is replaced by a single block of the reserved size, which
+ * is only possible if no autodiff variables are in use, that is at the
+ * start of a thread or after <code>recover_memory()</code>; otherwise
+ * only the var stacks are reserved. If STAN_MEMORY_HUGEPAGES is defined
+ * on Linux, the arena block is mapped with huge pages.
+ *
+ * A typical use is to record <code>memory_high_water_mark()</code>
+ * after a first gradient and to reserve it in every thread which
+ * computes further gradients.
+ *
+ * @param size memory to reserve
+ * @return true if the arena has been reserved
+ * @throw std::bad_alloc if the memory cannot be allocated
+ */
+static inline bool reserve_memory(const autodiff_memory_size& size) {
+  ChainableStack::instance_->var_stack_.reserve(size.var_stack_size);
+  ChainableStack::instance_->var_nochain_stack_.reserve(
+      size.var_nochain_stack_size);
+  return ChainableStack::instance_->memalloc_.reserve(size.arena_bytes);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
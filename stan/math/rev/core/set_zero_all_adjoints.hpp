@@ -4,6 +4,7 @@
 #include <stan/math/rev/core/vari.hpp>
 #include <stan/math/rev/core/chainable_alloc.hpp>
 #include <stan/math/rev/core/chainablestack.hpp>
+#include <algorithm>
 
 namespace stan {
 namespace math {
@@ -12,11 +13,12 @@ namespace math {
  * Reset all adjoint values in the stack to zero.
  */
 static void set_zero_all_adjoints() {
-  for (auto &x : ChainableStack::instance_->var_stack_) {
-    x->set_zero_adjoint();
-  }
-  for (auto &x : ChainableStack::instance_->var_nochain_stack_) {
-    x->set_zero_adjoint();
+  ChainableStack::instance_->var_stack_.for_each(
+      [](vari *x) { x->set_zero_adjoint(); });
+  ChainableStack::instance_->var_nochain_stack_.for_each(
+      [](vari *x) { x->set_zero_adjoint(); });
+  for (auto &adj : ChainableStack::instance_->var_matrix_adj_stack_) {
+    std::fill(adj.first, adj.first + adj.second, 0.0);
   }
 }
 
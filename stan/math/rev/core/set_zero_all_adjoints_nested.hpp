@@ -5,6 +5,7 @@
 #include <stan/math/rev/core/chainable_alloc.hpp>
 #include <stan/math/rev/core/chainablestack.hpp>
 #include <stan/math/rev/core/empty_nested.hpp>
+#include <algorithm>
 #include <stdexcept>
 
 namespace stan {
@@ -25,16 +26,24 @@ static void set_zero_all_adjoints_nested() {
   }
   size_t start1 = ChainableStack::instance_->nested_var_stack_sizes_.back();
   // avoid wrap with unsigned when start1 == 0
-  for (size_t i = (start1 == 0U) ? 0U : (start1 - 1);
-       i < ChainableStack::instance_->var_stack_.size(); ++i) {
-    ChainableStack::instance_->var_stack_[i]->set_zero_adjoint();
-  }
+  auto& var_stack = ChainableStack::instance_->var_stack_;
+  var_stack.for_each((start1 == 0U) ? 0U : (start1 - 1), var_stack.size(),
+                     [](vari* x) { x->set_zero_adjoint(); });
 
   size_t start2
       = ChainableStack::instance_->nested_var_nochain_stack_sizes_.back();
-  for (size_t i = (start2 == 0U) ? 0U : (start2 - 1);
-       i < ChainableStack::instance_->var_nochain_stack_.size(); ++i) {
-    ChainableStack::instance_->var_nochain_stack_[i]->set_zero_adjoint();
+  auto& var_nochain_stack = ChainableStack::instance_->var_nochain_stack_;
+  var_nochain_stack.for_each((start2 == 0U) ? 0U : (start2 - 1),
+                             var_nochain_stack.size(),
+                             [](vari* x) { x->set_zero_adjoint(); });
+
+  auto& var_matrix_adj_stack = ChainableStack::instance_->var_matrix_adj_stack_;
+  for (size_t i
+       = ChainableStack::instance_->nested_var_matrix_adj_stack_sizes_.back();
+       i < var_matrix_adj_stack.size(); ++i) {
+    std::fill(var_matrix_adj_stack[i].first,
+              var_matrix_adj_stack[i].first + var_matrix_adj_stack[i].second,
+              0.0);
   }
 }
 
@@ -0,0 +1,482 @@
+#ifndef STAN_MATH_REV_CORE_VAR_MATRIX_HPP
+#define STAN_MATH_REV_CORE_VAR_MATRIX_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/rev/core/arena_matrix.hpp>
+#include <stan/math/rev/core/chainablestack.hpp>
+#include <stan/math/rev/core/var.hpp>
+#include <stan/math/rev/core/vari.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace stan {
+namespace math {
+
+/**
+ * The vari of a matrix valued autodiff variable. Values and adjoints
+ * are stored as two contiguous matrices on the arena instead of one
+ * vari per element, so functions of matrix variables can read
+ * values and update adjoints with whole-matrix (BLAS level) operations.
+ *
+ * The scalar <code>val_</code> and <code>adj_</code> members inherited
+ * from <code>vari</code> are unused. The adjoints are registered on the
+ * autodiff stack, such that <code>set_zero_all_adjoints()</code>
+ * resets them without a virtual call per vari.
+ *
+ * @tparam MatrixType plain Eigen type of the value, one of
+ * <code>Eigen::MatrixXd</code>, <code>Eigen::VectorXd</code> or
+ * <code>Eigen::RowVectorXd</code>
+ */
+template <typename MatrixType>
+class var_matrix_vari : public vari {
+ public:
+  arena_matrix<MatrixType> vals_;
+  arena_matrix<MatrixType> adjs_;
+
+  /**
+   * Construct a matrix vari with the given value and zero adjoints.
+   *
+   * @tparam T type of the value expression
+   * @param x value
+   * @param stacked true if chain() needs to be called in the reverse
+   * pass, false for independent variables
+   */
+  template <typename T, require_eigen_t<T>* = nullptr>
+  explicit var_matrix_vari(const T& x, bool stacked = false)
+      : vari(0.0, stacked),
+        vals_(x),
+        adjs_(MatrixType::Zero(x.rows(), x.cols())) {
+    ChainableStack::instance_->var_matrix_adj_stack_.emplace_back(
+        adjs_.data(), adjs_.size());
+  }
+};
+
+/**
+ * A matrix valued autodiff variable in struct-of-arrays form. It wraps
+ * a pointer to a <code>var_matrix_vari</code> which holds the values
+ * and adjoints of all elements contiguously, in contrast to
+ * <code>Eigen::Matrix<var, R, C></code>, which holds one pointer per
+ * element.
+ *
+ * Use <code>to_var_matrix()</code> and <code>from_var_matrix()</code>
+ * to convert between the two representations.
+ *
+ * @tparam MatrixType plain Eigen type of the value
+ */
+template <typename MatrixType>
+class var_matrix {
+ public:
+  using value_type = MatrixType;
+  var_matrix_vari<MatrixType>* vi_;
+
+  /**
+   * Construct an uninitialized matrix variable.
+   */
+  var_matrix() : vi_(nullptr) {}
+
+  /**
+   * Construct a matrix variable from a pointer to its implementation.
+   *
+   * @param vi vari of the variable
+   */
+  explicit var_matrix(var_matrix_vari<MatrixType>* vi) : vi_(vi) {}
+
+  /**
+   * Construct an independent matrix variable with the given value.
+   *
+   * @tparam T type of the value expression
+   * @param x value
+   */
+  template <typename T, require_eigen_vt<std::is_arithmetic, T>* = nullptr>
+  explicit var_matrix(const T& x)
+      : vi_(new var_matrix_vari<MatrixType>(x)) {}
+
+  /**
+   * @return values of the elements
+   */
+  inline const arena_matrix<MatrixType>& val() const { return vi_->vals_; }
+
+  /**
+   * @return adjoints of the elements
+   */
+  inline arena_matrix<MatrixType>& adj() const { return vi_->adjs_; }
+
+  inline Eigen::Index rows() const { return vi_->vals_.rows(); }
+  inline Eigen::Index cols() const { return vi_->vals_.cols(); }
+  inline Eigen::Index size() const { return vi_->vals_.size(); }
+};
+
+namespace internal {
+
+/**
+ * Matrix vari whose reverse pass is given by a functor, which is called
+ * with the adjoints of the result. The functor must only capture
+ * trivially destructible objects, such as arena matrices and vari
+ * pointers, as varis are never destructed.
+ *
+ * @tparam MatrixType plain Eigen type of the value
+ * @tparam F type of the reverse pass functor
+ */
+template <typename MatrixType, typename F>
+class var_matrix_callback_vari : public var_matrix_vari<MatrixType> {
+ public:
+  F rev_functor_;
+
+  template <typename T>
+  var_matrix_callback_vari(const T& x, F&& rev_functor)
+      : var_matrix_vari<MatrixType>(x, true),
+        rev_functor_(std::forward<F>(rev_functor)) {}
+
+  void chain() override { rev_functor_(this->adjs_); }
+};
+
+/**
+ * Scalar vari whose reverse pass is given by a functor, which is called
+ * with the adjoint of the result. See var_matrix_callback_vari for the
+ * restrictions on the functor.
+ *
+ * @tparam F type of the reverse pass functor
+ */
+template <typename F>
+class scalar_callback_vari : public vari {
+ public:
+  F rev_functor_;
+
+  scalar_callback_vari(double x, F&& rev_functor)
+      : vari(x), rev_functor_(std::forward<F>(rev_functor)) {}
+
+  void chain() override { rev_functor_(adj_); }
+};
+
+/**
+ * Arena storage for an operand of a function of matrix variables. Holds
+ * the vari of a matrix variable and accumulates adjoints into it.
+ *
+ * @tparam T type of the operand
+ * @tparam StoreValues true if the reverse pass needs the values of the
+ * operand, unused for matrix variables
+ */
+template <typename T, bool StoreValues = true, typename = void>
+class var_matrix_operand {
+ public:
+  using matrix_t = typename std::decay_t<T>::value_type;
+  var_matrix_vari<matrix_t>* vi_;
+
+  explicit var_matrix_operand(const T& x) : vi_(x.vi_) {}
+
+  inline const arena_matrix<matrix_t>& val() const { return vi_->vals_; }
+
+  template <typename Expr>
+  inline void add_adj(const Expr& adj) const {
+    vi_->adjs_ += adj;
+  }
+};
+
+/**
+ * Arena storage for an arithmetic Eigen operand of a function of matrix
+ * variables whose values are needed in the reverse pass. The values are
+ * copied to the arena and adjoints are discarded without evaluating
+ * them.
+ *
+ * @tparam T type of the operand
+ */
+template <typename T>
+class var_matrix_operand<T, true, require_eigen_t<T>> {
+ public:
+  using matrix_t = plain_type_t<T>;
+  arena_matrix<matrix_t> val_;
+
+  explicit var_matrix_operand(const T& x) : val_(x) {}
+
+  inline const arena_matrix<matrix_t>& val() const { return val_; }
+
+  template <typename Expr>
+  inline void add_adj(const Expr& adj) const {}
+};
+
+/**
+ * Arena storage for an arithmetic Eigen operand of a function of matrix
+ * variables whose values are not needed in the reverse pass. Nothing is
+ * stored and adjoints are discarded without evaluating them.
+ *
+ * @tparam T type of the operand
+ */
+template <typename T>
+class var_matrix_operand<T, false, require_eigen_t<T>> {
+ public:
+  using matrix_t = plain_type_t<T>;
+
+  explicit var_matrix_operand(const T& x) {}
+
+  template <typename Expr>
+  inline void add_adj(const Expr& adj) const {}
+};
+
+/**
+ * Return the values of a matrix variable.
+ *
+ * @tparam MatrixType plain Eigen type of the value
+ * @param x matrix variable
+ * @return values
+ */
+template <typename MatrixType>
+inline const arena_matrix<MatrixType>& var_matrix_value(
+    const var_matrix<MatrixType>& x) {
+  return x.val();
+}
+
+/**
+ * Return the argument, an arithmetic Eigen operand of a function of
+ * matrix variables.
+ *
+ * @tparam T type of the operand
+ * @param x operand
+ * @return the argument
+ */
+template <typename T, require_eigen_t<T>* = nullptr>
+inline const T& var_matrix_value(const T& x) {
+  return x;
+}
+
+/**
+ * Return the value of a scalar operand of a function of matrix
+ * variables.
+ *
+ * @param x scalar variable
+ * @return value
+ */
+inline double var_matrix_value(const var& x) { return x.val(); }
+
+/**
+ * Return the argument, an arithmetic scalar operand of a function of
+ * matrix variables.
+ *
+ * @tparam T arithmetic type
+ * @param x operand
+ * @return the argument
+ */
+template <typename T, require_arithmetic_t<T>* = nullptr>
+inline double var_matrix_value(T x) {
+  return x;
+}
+
+/**
+ * Return the value of a scalar operand of a function broadcasting
+ * scalars over matrix variables.
+ *
+ * @tparam T type of the operand, double, int or var
+ * @param x operand
+ * @return value
+ */
+template <typename T, require_stan_scalar_t<T>* = nullptr>
+inline double flat_values(const T& x) {
+  return var_matrix_value(x);
+}
+
+/**
+ * Return the values of a matrix variable as a flat array in column
+ * major order.
+ *
+ * @tparam MatrixType plain Eigen type of the value
+ * @param x matrix variable
+ * @return map of the values
+ */
+template <typename MatrixType>
+inline Eigen::Map<const Eigen::ArrayXd> flat_values(
+    const var_matrix<MatrixType>& x) {
+  return Eigen::Map<const Eigen::ArrayXd>(x.val().data(), x.size());
+}
+
+/**
+ * Copy an arithmetic Eigen operand to the arena and return its values
+ * as a flat array in column major order.
+ *
+ * @tparam T type of the operand
+ * @param x operand
+ * @return map of the copied values
+ */
+template <typename T, require_eigen_t<T>* = nullptr>
+inline Eigen::Map<const Eigen::ArrayXd> flat_values(const T& x) {
+  double* mem
+      = ChainableStack::instance_->memalloc_.alloc_array<double>(x.size());
+  Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>>(
+      mem, x.rows(), x.cols())
+      = x;
+  return Eigen::Map<const Eigen::ArrayXd>(mem, x.size());
+}
+
+/**
+ * Return the vari to which <code>add_flat_adj()</code> adds the
+ * adjoints of a scalar variable broadcast to a matrix.
+ *
+ * @param x scalar variable
+ * @return vari of the variable
+ */
+inline vari* flat_operand(const var& x) { return x.vi_; }
+
+/**
+ * Return the vari to which <code>add_flat_adj()</code> adds the
+ * adjoints of a matrix variable.
+ *
+ * @tparam MatrixType plain Eigen type of the value
+ * @param x matrix variable
+ * @return vari of the variable
+ */
+template <typename MatrixType>
+inline var_matrix_vari<MatrixType>* flat_operand(
+    const var_matrix<MatrixType>& x) {
+  return x.vi_;
+}
+
+/**
+ * Return a null pointer for arithmetic operands, which have no
+ * adjoints.
+ *
+ * @tparam T type of the operand, an arithmetic scalar or Eigen type
+ * @param x operand
+ * @return null pointer
+ */
+template <typename T, require_t<disjunction<std::is_arithmetic<T>,
+                                            is_eigen<T>>>* = nullptr>
+inline std::nullptr_t flat_operand(const T& x) {
+  return nullptr;
+}
+
+/**
+ * Add the sum of the adjoints of a scalar broadcast to a matrix to the
+ * scalar variable.
+ *
+ * @tparam Expr type of the adjoint array expression
+ * @param vi vari of the scalar
+ * @param adj adjoints of the broadcast elements
+ */
+template <typename Expr>
+inline void add_flat_adj(vari* vi, const Expr& adj) {
+  vi->adj_ += adj.sum();
+}
+
+/**
+ * Add the adjoints, given as a flat array in column major order, to a
+ * matrix variable.
+ *
+ * @tparam MatrixType plain Eigen type of the value
+ * @tparam Expr type of the adjoint array expression
+ * @param vi vari of the matrix variable
+ * @param adj adjoints of the elements
+ */
+template <typename MatrixType, typename Expr>
+inline void add_flat_adj(var_matrix_vari<MatrixType>* vi, const Expr& adj) {
+  Eigen::Map<Eigen::ArrayXd>(vi->adjs_.data(), vi->adjs_.size()) += adj;
+}
+
+/**
+ * No-op for arithmetic operands. The adjoint expression is not
+ * evaluated.
+ *
+ * @tparam Expr type of the adjoint array expression
+ * @param vi ignored
+ * @param adj ignored
+ */
+template <typename Expr>
+inline void add_flat_adj(std::nullptr_t vi, const Expr& adj) {}
+
+/**
+ * Return a matrix variable whose value is the given expression and
+ * whose reverse pass calls the given functor with the adjoints of the
+ * result.
+ *
+ * @tparam T type of the value expression
+ * @tparam F type of the reverse pass functor
+ * @param x value
+ * @param rev_functor reverse pass
+ * @return matrix variable
+ */
+template <typename T, typename F>
+inline var_matrix<plain_type_t<T>> make_var_matrix(const T& x,
+                                                   F&& rev_functor) {
+  using matrix_t = plain_type_t<T>;
+  return var_matrix<matrix_t>(
+      new var_matrix_callback_vari<matrix_t, std::decay_t<F>>(
+          x, std::forward<F>(rev_functor)));
+}
+
+/**
+ * Return a scalar variable with the given value whose reverse pass
+ * calls the given functor with the adjoint of the result.
+ *
+ * @tparam F type of the reverse pass functor
+ * @param x value
+ * @param rev_functor reverse pass
+ * @return scalar variable
+ */
+template <typename F>
+inline var make_callback_var(double x, F&& rev_functor) {
+  return var(new scalar_callback_vari<std::decay_t<F>>(
+      x, std::forward<F>(rev_functor)));
+}
+
+}  // namespace internal
+
+/**
+ * Convert a matrix of autodiff variables into a matrix variable in
+ * struct-of-arrays form. Adjoints of the result are propagated to the
+ * elements of the argument.
+ *
+ * @tparam R number of rows, can be Eigen::Dynamic
+ * @tparam C number of columns, can be Eigen::Dynamic
+ * @param x matrix of variables
+ * @return matrix variable with the same values
+ */
+template <int R, int C>
+inline var_matrix<Eigen::Matrix<double, R, C>> to_var_matrix(
+    const Eigen::Matrix<var, R, C>& x) {
+  arena_matrix<Eigen::Matrix<vari*, R, C>> x_vi = x.vi();
+  return internal::make_var_matrix(
+      x.val(), [x_vi](const auto& adj) mutable { x_vi.adj() += adj; });
+}
+
+/**
+ * Return the argument, which is already in struct-of-arrays form.
+ *
+ * @tparam MatrixType plain Eigen type of the value
+ * @param x matrix variable
+ * @return the argument
+ */
+template <typename MatrixType>
+inline const var_matrix<MatrixType>& to_var_matrix(
+    const var_matrix<MatrixType>& x) {
+  return x;
+}
+
+/**
+ * Convert a matrix variable in struct-of-arrays form into a matrix of
+ * autodiff variables. Adjoints of the elements of the result are
+ * propagated to the argument.
+ *
+ * @tparam MatrixType plain Eigen type of the value
+ * @param x matrix variable
+ * @return matrix of variables with the same values
+ */
+template <typename MatrixType>
+inline Eigen::Matrix<var, MatrixType::RowsAtCompileTime,
+                     MatrixType::ColsAtCompileTime>
+from_var_matrix(const var_matrix<MatrixType>& x) {
+  using vari_matrix_t = Eigen::Matrix<vari*, MatrixType::RowsAtCompileTime,
+                                      MatrixType::ColsAtCompileTime>;
+  arena_matrix<vari_matrix_t> res_vi = x.val().unaryExpr(
+      [](double v) { return new vari(v, false); });
+  auto* x_vi = x.vi_;
+  internal::make_callback_var(0.0, [res_vi, x_vi](double adj) mutable {
+    x_vi->adjs_ += res_vi.adj();
+  });
+  Eigen::Matrix<var, MatrixType::RowsAtCompileTime,
+                MatrixType::ColsAtCompileTime>
+      res(x.rows(), x.cols());
+  res.vi() = res_vi;
+  return res;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
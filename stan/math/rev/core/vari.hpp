@@ -31,6 +31,24 @@ class vari {
  private:
   friend class var;
 
+#ifdef STAN_AD_PROFILE
+  /**
+   * Count this vari for the profiled function being called and
+   * record the function for the vari's entry on the stack to chain.
+   *
+   * @param stacked true if the vari is on the stack to chain
+   */
+  static inline void profile_push(bool stacked) {
+    profile_info* profile = ChainableStack::instance_->profile_current();
+    if (stacked) {
+      ChainableStack::instance_->var_stack_profile_.push_back(profile);
+      ++profile->chain_varis_;
+    } else {
+      ++profile->nochain_varis_;
+    }
+  }
+#endif
+
  public:
   /**
    * The value of this variable.
@@ -57,6 +75,9 @@ class vari {
    */
   explicit vari(double x) : val_(x), adj_(0.0) {
     ChainableStack::instance_->var_stack_.push_back(this);
+#ifdef STAN_AD_PROFILE
+    profile_push(true);
+#endif
   }
 
   vari(double x, bool stacked) : val_(x), adj_(0.0) {
@@ -65,6 +86,9 @@ class vari {
     } else {
       ChainableStack::instance_->var_nochain_stack_.push_back(this);
     }
+#ifdef STAN_AD_PROFILE
+    profile_push(stacked);
+#endif
   }
 
   /**
@@ -15,6 +15,9 @@
 #include <stan/math/opencl/rev/opencl.hpp>
 #endif
 
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
 #include <algorithm>
 #include <vector>
 
@@ -44,6 +47,33 @@ inline void set_lower_tri_coeff_ref(Eigen::Matrix<var, -1, -1>& L,
   }
   return;
 }
+
+/**
+ * Apply the given functor to consecutive ranges of the indices
+ * <code>[0, size)</code>. The ranges are processed in parallel by TBB
+ * tasks if STAN_THREADS is defined and serially as a single range
+ * otherwise. The functor is called with the start and the length of
+ * each range and must only write to data belonging to its range.
+ *
+ * @tparam F type of the functor
+ * @param size number of indices
+ * @param grainsize minimal length of a range processed by one task
+ * @param f functor
+ */
+template <typename F>
+inline void cholesky_parallel_ranges(int size, int grainsize, F&& f) {
+  if (size <= 0) {
+    return;
+  }
+#ifdef STAN_THREADS
+  tbb::parallel_for(tbb::blocked_range<int>(0, size, grainsize),
+                    [&f](const tbb::blocked_range<int>& r) {
+                      f(r.begin(), r.end() - r.begin());
+                    });
+#else
+  f(0, size);
+#endif
+}
 }  // namespace internal
 
 class cholesky_block : public vari {
@@ -51,8 +81,9 @@ class cholesky_block : public vari {
   int M_;
   int block_size_;
   using Block_ = Eigen::Block<Eigen::MatrixXd>;
-  vari** vari_ref_A_;
-  vari** vari_ref_L_;
+  arena_matrix<Eigen::Matrix<vari*, -1, 1>> vari_ref_A_;
+  arena_matrix<Eigen::Matrix<vari*, -1, 1>> vari_ref_L_;
+  arena_matrix<Eigen::MatrixXd> L_;
 
   /**
    * Constructor for Cholesky function.
@@ -65,6 +96,10 @@ class cholesky_block : public vari {
    * and computation. Note that varis for L are constructed externally in
    * cholesky_decompose.
    *
+   * The values of L are also kept as a dense lower triangular matrix on
+   * the arena, so the reverse pass does not need to gather them from
+   * the varis.
+   *
    * block_size_ determined using the same calculation Eigen/LLT.h
    *
    * @param A matrix
@@ -74,10 +109,9 @@ class cholesky_block : public vari {
                  const Eigen::Matrix<double, -1, -1>& L_A)
       : vari(0.0),
         M_(A.rows()),
-        vari_ref_A_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
-            A.rows() * (A.rows() + 1) / 2)),
-        vari_ref_L_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
-            A.rows() * (A.rows() + 1) / 2)) {
+        vari_ref_A_(A.rows() * (A.rows() + 1) / 2),
+        vari_ref_L_(A.rows() * (A.rows() + 1) / 2),
+        L_(L_A.triangularView<Eigen::Lower>()) {
     size_t pos = 0;
     block_size_ = std::max(M_ / 8, 8);
     block_size_ = std::min(block_size_, 128);
@@ -93,10 +127,10 @@ class cholesky_block : public vari {
   /**
    * Symbolic adjoint calculation for Cholesky factor A
    *
-   * @param L Cholesky factor
+   * @param L Cholesky factor, transposed in place
    * @param L_adj matrix of adjoints of L
    */
-  inline void symbolic_rev(Block_& L, Block_& L_adj) {
+  inline void symbolic_rev(Eigen::MatrixXd& L, Block_& L_adj) {
     using Eigen::Lower;
     using Eigen::StrictlyUpper;
     using Eigen::Upper;
@@ -113,45 +147,59 @@ class cholesky_block : public vari {
    *
    * Iain Murray: Differentiation of the Cholesky decomposition, 2016.
    *
+   * Only the lower triangle of the adjoint of L is copied into a dense
+   * work matrix. The updates of the blocks below and left of the
+   * diagonal block, which dominate the cost for large matrices, are
+   * split into independent row or column ranges and run in parallel
+   * when STAN_THREADS is defined.
    */
   virtual void chain() {
-    using Eigen::Block;
     using Eigen::Lower;
-    using Eigen::MatrixXd;
     using Eigen::StrictlyUpper;
     using Eigen::Upper;
-    auto L_adj = Eigen::MatrixXd::Zero(M_, M_).eval();
-    auto L = Eigen::MatrixXd::Zero(M_, M_).eval();
+    using ConstBlock_ = Eigen::Block<const Eigen::Map<Eigen::MatrixXd>>;
+    // the strictly upper triangle is never read outside of the diagonal
+    // blocks, which symbolic_rev fills in before using them
+    Eigen::MatrixXd L_adj(M_, M_);
     size_t pos = 0;
     for (size_type j = 0; j < M_; ++j) {
       for (size_type i = j; i < M_; ++i) {
-        L_adj.coeffRef(i, j) = vari_ref_L_[pos]->adj_;
-        L.coeffRef(i, j) = vari_ref_L_[pos]->val_;
-        ++pos;
+        L_adj.coeffRef(i, j) = vari_ref_L_[pos++]->adj_;
       }
     }
 
+    const Eigen::Map<Eigen::MatrixXd>& L = L_;
     for (int k = M_; k > 0; k -= block_size_) {
       int j = std::max(0, k - block_size_);
-      Block_ R = L.block(j, 0, k - j, j);
-      Block_ D = L.block(j, j, k - j, k - j);
-      Block_ B = L.block(k, 0, M_ - k, j);
-      Block_ C = L.block(k, j, M_ - k, k - j);
+      ConstBlock_ R = L.block(j, 0, k - j, j);
+      Eigen::MatrixXd D = L.block(j, j, k - j, k - j);
+      ConstBlock_ B = L.block(k, 0, M_ - k, j);
+      ConstBlock_ C = L.block(k, j, M_ - k, k - j);
       Block_ R_adj = L_adj.block(j, 0, k - j, j);
       Block_ D_adj = L_adj.block(j, j, k - j, k - j);
       Block_ B_adj = L_adj.block(k, 0, M_ - k, j);
       Block_ C_adj = L_adj.block(k, j, M_ - k, k - j);
       if (C_adj.size() > 0) {
-        C_adj = D.transpose()
-                    .triangularView<Upper>()
-                    .solve(C_adj.transpose())
-                    .transpose();
-        B_adj.noalias() -= C_adj * R;
+        internal::cholesky_parallel_ranges(
+            M_ - k, block_size_, [&](int start, int size) {
+              auto C_adj_rows = C_adj.middleRows(start, size);
+              C_adj_rows = D.transpose()
+                               .triangularView<Upper>()
+                               .solve(C_adj_rows.transpose())
+                               .transpose();
+              B_adj.middleRows(start, size).noalias() -= C_adj_rows * R;
+            });
         D_adj.noalias() -= C_adj.transpose() * C;
       }
       symbolic_rev(D, D_adj);
-      R_adj.noalias() -= C_adj.transpose() * B;
-      R_adj.noalias() -= D_adj.selfadjointView<Lower>() * R;
+      internal::cholesky_parallel_ranges(
+          j, block_size_, [&](int start, int size) {
+            auto R_adj_cols = R_adj.middleCols(start, size);
+            R_adj_cols.noalias()
+                -= C_adj.transpose() * B.middleCols(start, size);
+            R_adj_cols.noalias()
+                -= D_adj.selfadjointView<Lower>() * R.middleCols(start, size);
+          });
       D_adj.diagonal() *= 0.5;
       D_adj.triangularView<StrictlyUpper>().setZero();
     }
@@ -167,8 +215,8 @@ class cholesky_block : public vari {
 class cholesky_scalar : public vari {
  public:
   int M_;
-  vari** vari_ref_A_;
-  vari** vari_ref_L_;
+  arena_matrix<Eigen::Matrix<vari*, -1, 1>> vari_ref_A_;
+  arena_matrix<Eigen::Matrix<vari*, -1, 1>> vari_ref_L_;
 
   /**
    * Constructor for Cholesky function.
@@ -188,10 +236,8 @@ class cholesky_scalar : public vari {
                   const Eigen::Matrix<double, -1, -1>& L_A)
       : vari(0.0),
         M_(A.rows()),
-        vari_ref_A_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
-            A.rows() * (A.rows() + 1) / 2)),
-        vari_ref_L_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
-            A.rows() * (A.rows() + 1) / 2)) {
+        vari_ref_A_(A.rows() * (A.rows() + 1) / 2),
+        vari_ref_L_(A.rows() * (A.rows() + 1) / 2) {
     size_t accum = 0;
     size_t accum_i = accum;
     for (size_type j = 0; j < M_; ++j) {
@@ -257,8 +303,8 @@ class cholesky_scalar : public vari {
 class cholesky_opencl : public vari {
  public:
   int M_;
-  vari** vari_ref_A_;
-  vari** vari_ref_L_;
+  arena_matrix<Eigen::Matrix<vari*, -1, 1>> vari_ref_A_;
+  arena_matrix<Eigen::Matrix<vari*, -1, 1>> vari_ref_L_;
 
   /**
    * Constructor for OpenCL Cholesky function.
@@ -278,10 +324,8 @@ class cholesky_opencl : public vari {
                   const Eigen::Matrix<double, -1, -1>& L_A)
       : vari(0.0),
         M_(A.rows()),
-        vari_ref_A_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
-            A.rows() * (A.rows() + 1) / 2)),
-        vari_ref_L_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
-            A.rows() * (A.rows() + 1) / 2)) {
+        vari_ref_A_(A.rows() * (A.rows() + 1) / 2),
+        vari_ref_L_(A.rows() * (A.rows() + 1) / 2) {
     size_t pos = 0;
     for (size_type j = 0; j < M_; ++j) {
       for (size_type i = j; i < M_; ++i) {
@@ -316,7 +360,8 @@ class cholesky_opencl : public vari {
   virtual void chain() {
     const int packed_size = M_ * (M_ + 1) / 2;
     std::vector<double> L_adj_cpu(packed_size);
-    matrix_cl<var> L = packed_copy<matrix_cl_view::Lower>(vari_ref_L_, M_);
+    matrix_cl<var> L
+        = packed_copy<matrix_cl_view::Lower>(vari_ref_L_.data(), M_);
     int block_size
         = M_ / opencl_context.tuning_opts().cholesky_rev_block_partition;
     block_size = std::max(block_size, 8);
@@ -377,6 +422,7 @@ class cholesky_opencl : public vari {
 template <typename T, require_eigen_vt<is_var, T>* = nullptr>
 inline Eigen::Matrix<var, T::RowsAtCompileTime, T::ColsAtCompileTime>
 cholesky_decompose(const T& A) {
+  profile_scope profile("cholesky_decompose");
   Eigen::Matrix<double, T::RowsAtCompileTime, T::ColsAtCompileTime> L_A(
       value_of_rec(A));
   check_not_nan("cholesky_decompose", "A", L_A);
@@ -414,20 +460,60 @@ cholesky_decompose(const T& A) {
     if (L_A.rows()
         > opencl_context.tuning_opts().cholesky_size_worth_transfer) {
       cholesky_opencl* baseVari = new cholesky_opencl(A, L_A);
-      internal::set_lower_tri_coeff_ref(L, baseVari->vari_ref_L_);
+      internal::set_lower_tri_coeff_ref(L, baseVari->vari_ref_L_.data());
     } else {
       cholesky_block* baseVari = new cholesky_block(A, L_A);
-      internal::set_lower_tri_coeff_ref(L, baseVari->vari_ref_L_);
+      internal::set_lower_tri_coeff_ref(L, baseVari->vari_ref_L_.data());
     }
 #else
     cholesky_block* baseVari = new cholesky_block(A, L_A);
-    internal::set_lower_tri_coeff_ref(L, baseVari->vari_ref_L_);
+    internal::set_lower_tri_coeff_ref(L, baseVari->vari_ref_L_.data());
 #endif
   }
 
   return L;
 }
 
+/**
+ * Reverse mode specialization of Cholesky decomposition for a matrix
+ * variable in struct-of-arrays form.
+ *
+ * The adjoint of the lower triangular part of A is computed in one
+ * pass with dense triangular solves (Murray, 2016, with a single
+ * block). As for the other specializations, only the lower triangular
+ * part of A receives adjoints.
+ *
+ * @tparam T type of the matrix, a var_matrix
+ * @param A Matrix
+ * @return L Cholesky factor of A, with zeros above the diagonal
+ */
+template <typename T, require_var_matrix_t<T>* = nullptr>
+inline T cholesky_decompose(const T& A) {
+  profile_scope profile("cholesky_decompose");
+  Eigen::MatrixXd A_val = A.val();
+  check_not_nan("cholesky_decompose", "A", A_val);
+  check_symmetric("cholesky_decompose", "A", A_val);
+  Eigen::LLT<Eigen::Ref<Eigen::MatrixXd>, Eigen::Lower> L_factor(A_val);
+  check_pos_definite("cholesky_decompose", "A", L_factor);
+
+  arena_matrix<Eigen::MatrixXd> L_A
+      = A_val.template triangularView<Eigen::Lower>();
+  auto* A_vi = A.vi_;
+  return internal::make_var_matrix(L_A, [A_vi, L_A](const auto& L_adj) {
+    using Eigen::Lower;
+    using Eigen::StrictlyUpper;
+    using Eigen::Upper;
+    Eigen::MatrixXd L = L_A.transpose();
+    Eigen::MatrixXd A_adj = L * L_adj.template triangularView<Lower>();
+    A_adj.template triangularView<StrictlyUpper>()
+        = A_adj.adjoint().template triangularView<StrictlyUpper>();
+    L.template triangularView<Upper>().solveInPlace(A_adj);
+    L.template triangularView<Upper>().solveInPlace(A_adj.transpose());
+    A_adj.diagonal() *= 0.5;
+    A_vi->adjs_.template triangularView<Lower>() += A_adj;
+  });
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,215 @@
+#ifndef STAN_MATH_REV_FUN_CSR_MATRIX_TIMES_VECTOR_HPP
+#define STAN_MATH_REV_FUN_CSR_MATRIX_TIMES_VECTOR_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/csr_u_to_z.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Return the vari of an autodiff variable.
+ */
+inline vari* get_vari(const var& x) { return x.vi_; }
+
+/**
+ * Placeholder for arithmetic arguments, which have no vari.
+ */
+inline vari* get_vari(double x) { return nullptr; }
+
+/**
+ * This is a subclass of the vari class for the product of a sparse
+ * matrix in compressed sparse row (CSR) format with a dense vector.
+ *
+ * The sparsity structure is copied once into the arena with zero-based
+ * indices. Values of arguments which are autodiff variables are read
+ * from their varis, so only the values of arithmetic arguments are
+ * copied. The adjoints of all rows are propagated to w and b in a
+ * single chain() call.
+ *
+ * @tparam T1 type of elements in the sparse matrix
+ * @tparam T2 type of elements in the dense vector
+ */
+template <typename T1, typename T2>
+class csr_matrix_times_vector_vari : public vari {
+ public:
+  int m_;
+  int* u_;
+  int* v_;
+  double* w_d_;
+  double* b_d_;
+  vari** w_vi_;
+  vari** b_vi_;
+  vari** result_vi_;
+
+  /**
+   * Constructor for csr_matrix_times_vector_vari. All memory is
+   * allocated in the arena. The varis of the result are not put on
+   * the var stack as this vari propagates their adjoints.
+   *
+   * The arguments are assumed to have been checked for consistency.
+   *
+   * @param m Number of rows in matrix.
+   * @param w Vector of non-zero values in matrix.
+   * @param v Column index of each non-zero value, same
+   *          length as w.
+   * @param u Index of where each row starts in w, length equal to
+   *          the number of rows plus one.
+   * @param b Eigen vector which the matrix is multiplied by.
+   */
+  csr_matrix_times_vector_vari(int m,
+                               const Eigen::Matrix<T1, Eigen::Dynamic, 1>& w,
+                               const std::vector<int>& v,
+                               const std::vector<int>& u,
+                               const Eigen::Matrix<T2, Eigen::Dynamic, 1>& b)
+      : vari(0.0),
+        m_(m),
+        u_(ChainableStack::instance_->memalloc_.alloc_array<int>(m + 1)),
+        v_(ChainableStack::instance_->memalloc_.alloc_array<int>(v.size())),
+        w_d_(!is_var<T1>::value
+                 ? ChainableStack::instance_->memalloc_.alloc_array<double>(
+                       w.size())
+                 : nullptr),
+        b_d_(!is_var<T2>::value
+                 ? ChainableStack::instance_->memalloc_.alloc_array<double>(
+                       b.size())
+                 : nullptr),
+        w_vi_(is_var<T1>::value
+                  ? ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+                        w.size())
+                  : nullptr),
+        b_vi_(is_var<T2>::value
+                  ? ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+                        b.size())
+                  : nullptr),
+        result_vi_(
+            ChainableStack::instance_->memalloc_.alloc_array<vari*>(m)) {
+    for (int row = 0; row < m; ++row) {
+      u_[row] = u[row] - stan::error_index::value;
+    }
+    u_[m] = u_[m - 1] + csr_u_to_z(u, m - 1);
+    for (size_t nze = 0; nze < v.size(); ++nze) {
+      v_[nze] = v[nze] - stan::error_index::value;
+    }
+    for (int i = 0; i < w.size(); ++i) {
+      if (is_var<T1>::value) {
+        w_vi_[i] = get_vari(w.coeff(i));
+      } else {
+        w_d_[i] = value_of(w.coeff(i));
+      }
+    }
+    for (int i = 0; i < b.size(); ++i) {
+      if (is_var<T2>::value) {
+        b_vi_[i] = get_vari(b.coeff(i));
+      } else {
+        b_d_[i] = value_of(b.coeff(i));
+      }
+    }
+    for (int row = 0; row < m; ++row) {
+      double sum = 0;
+      for (int nze = u_[row]; nze < u_[row + 1]; ++nze) {
+        sum += value_of(w.coeff(nze)) * value_of(b.coeff(v_[nze]));
+      }
+      result_vi_[row] = new vari(sum, false);
+    }
+  }
+
+  virtual void chain() {
+    for (int row = 0; row < m_; ++row) {
+      const double adj = result_vi_[row]->adj_;
+      for (int nze = u_[row]; nze < u_[row + 1]; ++nze) {
+        if (is_var<T1>::value) {
+          w_vi_[nze]->adj_ += adj * b_value(v_[nze]);
+        }
+        if (is_var<T2>::value) {
+          b_vi_[v_[nze]]->adj_ += adj * w_value(nze);
+        }
+      }
+    }
+  }
+
+ private:
+  /**
+   * Return the value of the i-th element of w, read from the stored
+   * varis if w is a var and from the stored values otherwise.
+   */
+  inline double w_value(int i) const {
+    return is_var<T1>::value ? w_vi_[i]->val_ : w_d_[i];
+  }
+
+  /**
+   * Return the value of the i-th element of b, read from the stored
+   * varis if b is a var and from the stored values otherwise.
+   */
+  inline double b_value(int i) const {
+    return is_var<T2>::value ? b_vi_[i]->val_ : b_d_[i];
+  }
+};
+
+}  // namespace internal
+
+/**
+ * \addtogroup csr_format
+ * Return the multiplication of the sparse matrix (specified by
+ * by values and indexing) by the specified dense vector for the case
+ * that the values or the vector are autodiff variables.
+ *
+ * The whole product is recorded on the autodiff stack as a single
+ * vari, which propagates the adjoints of all rows in one pass.
+ *
+ * See the primitive version for a description of the storage format.
+ *
+ * @tparam T1 type of elements in the sparse matrix
+ * @tparam T2 type of elements in the dense vector
+ * @param m Number of rows in matrix.
+ * @param n Number of columns in matrix.
+ * @param w Vector of non-zero values in matrix.
+ * @param v Column index of each non-zero value, same
+ *          length as w.
+ * @param u Index of where each row starts in w, length equal to
+ *          the number of rows plus one.
+ * @param b Eigen vector which the matrix is multiplied by.
+ * @return Dense vector for the product.
+ * @throw std::domain_error if m and n are not positive or are nan.
+ * @throw std::domain_error if the implied sparse matrix and b are
+ *                          not multiplicable.
+ * @throw std::invalid_argument if m/n/w/v/u are not internally
+ *   consistent, as defined by the indexing scheme.
+ * @throw std::out_of_range if any of the indexes are out of range.
+ */
+template <typename T1, typename T2, require_any_var_t<T1, T2>* = nullptr>
+inline Eigen::Matrix<var, Eigen::Dynamic, 1> csr_matrix_times_vector(
+    int m, int n, const Eigen::Matrix<T1, Eigen::Dynamic, 1>& w,
+    const std::vector<int>& v, const std::vector<int>& u,
+    const Eigen::Matrix<T2, Eigen::Dynamic, 1>& b) {
+  check_positive("csr_matrix_times_vector", "m", m);
+  check_positive("csr_matrix_times_vector", "n", n);
+  check_size_match("csr_matrix_times_vector", "n", n, "b", b.size());
+  check_size_match("csr_matrix_times_vector", "m", m, "u", u.size() - 1);
+  check_size_match("csr_matrix_times_vector", "w", w.size(), "v", v.size());
+  check_size_match("csr_matrix_times_vector", "u/z",
+                   u[m - 1] + csr_u_to_z(u, m - 1) - 1, "v", v.size());
+  for (int i : v) {
+    check_range("csr_matrix_times_vector", "v[]", n, i);
+  }
+
+  auto* baseVari
+      = new internal::csr_matrix_times_vector_vari<T1, T2>(m, w, v, u, b);
+  Eigen::Matrix<var, Eigen::Dynamic, 1> result(m);
+  for (int row = 0; row < m; ++row) {
+    result.coeffRef(row).vi_ = baseVari->result_vi_[row];
+  }
+  return result;
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -236,6 +236,39 @@ inline return_type_t<T1, T2> dot_product(const std::vector<T1>& v1,
   return var(new internal::dot_product_vari<T1, T2>(&v1[0], &v2[0], v1.size()));
 }
 
+/**
+ * Returns the dot product of two column vectors, at least one of which
+ * is a matrix variable in struct-of-arrays form.
+ *
+ * @tparam T1 type of the first vector, a var_matrix or an Eigen type
+ * with arithmetic scalars
+ * @tparam T2 type of the second vector, a var_matrix or an Eigen type
+ * with arithmetic scalars
+ * @param[in] v1 First column vector.
+ * @param[in] v2 Second column vector.
+ * @return Dot product of the vectors.
+ * @throw std::domain_error if sizes of v1 and v2 do not match.
+ */
+template <typename T1, typename T2,
+          require_all_var_matrix_or_eigen_t<T1, T2>* = nullptr,
+          require_any_var_matrix_t<T1, T2>* = nullptr>
+inline var dot_product(const T1& v1, const T2& v2) {
+  static_assert(
+      internal::var_matrix_operand<T1>::matrix_t::ColsAtCompileTime == 1
+          && internal::var_matrix_operand<T2>::matrix_t::ColsAtCompileTime
+                 == 1,
+      "dot_product of matrix variables requires column vectors");
+  check_matching_sizes("dot_product", "v1", internal::var_matrix_value(v1),
+                       "v2", internal::var_matrix_value(v2));
+  internal::var_matrix_operand<T1> arena_v1(v1);
+  internal::var_matrix_operand<T2> arena_v2(v2);
+  return internal::make_callback_var(
+      arena_v1.val().dot(arena_v2.val()), [arena_v1, arena_v2](double adj) {
+        arena_v1.add_adj(adj * arena_v2.val());
+        arena_v2.add_adj(adj * arena_v1.val());
+      });
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
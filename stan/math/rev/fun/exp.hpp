@@ -57,6 +57,23 @@ inline std::complex<var> exp(const std::complex<var>& z) {
   return internal::complex_exp(z);
 }
 
+/**
+ * Values and derivatives of the exponential over arrays of doubles,
+ * such that containers of <code>var</code> are differentiated with a
+ * single vari.
+ */
+template <>
+struct apply_scalar_unary_vectorized<exp_fun> : std::true_type {
+  template <typename T>
+  static inline auto value(const T& x) {
+    return exp(x);
+  }
+  template <typename T1, typename T2>
+  static inline auto derivative(const T1& x, const T2& fx) {
+    return fx;
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
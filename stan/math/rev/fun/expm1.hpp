@@ -45,6 +45,23 @@ class expm1_vari : public op_v_vari {
  */
 inline var expm1(const var& a) { return var(new internal::expm1_vari(a.vi_)); }
 
+/**
+ * Values and derivatives of expm1 over arrays of doubles,
+ * such that containers of <code>var</code> are differentiated with a
+ * single vari.
+ */
+template <>
+struct apply_scalar_unary_vectorized<expm1_fun> : std::true_type {
+  template <typename T>
+  static inline auto value(const T& x) {
+    return expm1(x);
+  }
+  template <typename T1, typename T2>
+  static inline auto derivative(const T1& x, const T2& fx) {
+    return fx + 1;
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -33,6 +33,23 @@ inline var inv_logit(const var& a) {
   return var(new internal::inv_logit_vari(a.vi_));
 }
 
+/**
+ * Values and derivatives of the inverse logit over arrays of doubles,
+ * such that containers of <code>var</code> are differentiated with a
+ * single vari.
+ */
+template <>
+struct apply_scalar_unary_vectorized<inv_logit_fun> : std::true_type {
+  template <typename T>
+  static inline auto value(const T& x) {
+    return inv_logit(x);
+  }
+  template <typename T1, typename T2>
+  static inline auto derivative(const T1& x, const T2& fx) {
+    return fx * (1 - fx);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -31,6 +31,23 @@ inline var lgamma(const var& a) {
   return var(new internal::lgamma_vari(lgamma(a.val()), a.vi_));
 }
 
+/**
+ * Values and derivatives of the log gamma function over arrays of doubles,
+ * such that containers of <code>var</code> are differentiated with a
+ * single vari.
+ */
+template <>
+struct apply_scalar_unary_vectorized<lgamma_fun> : std::true_type {
+  template <typename T>
+  static inline auto value(const T& x) {
+    return lgamma(x);
+  }
+  template <typename T1, typename T2>
+  static inline auto derivative(const T1& x, const T2& fx) {
+    return digamma(x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -66,6 +66,23 @@ inline std::complex<var> log(const std::complex<var>& z) {
   return internal::complex_log(z);
 }
 
+/**
+ * Values and derivatives of the natural logarithm over arrays of doubles,
+ * such that containers of <code>var</code> are differentiated with a
+ * single vari.
+ */
+template <>
+struct apply_scalar_unary_vectorized<log_fun> : std::true_type {
+  template <typename T>
+  static inline auto value(const T& x) {
+    return log(x);
+  }
+  template <typename T1, typename T2>
+  static inline auto derivative(const T1& x, const T2& fx) {
+    return 1 / x;
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
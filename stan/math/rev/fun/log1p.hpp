@@ -28,6 +28,23 @@ class log1p_vari : public op_v_vari {
  */
 inline var log1p(const var& a) { return var(new internal::log1p_vari(a.vi_)); }
 
+/**
+ * Values and derivatives of log1p over arrays of doubles,
+ * such that containers of <code>var</code> are differentiated with a
+ * single vari.
+ */
+template <>
+struct apply_scalar_unary_vectorized<log1p_fun> : std::true_type {
+  template <typename T>
+  static inline auto value(const T& x) {
+    return log1p(x);
+  }
+  template <typename T1, typename T2>
+  static inline auto derivative(const T1& x, const T2& fx) {
+    return 1 / (1 + x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -25,6 +25,23 @@ inline var log1p_exp(const var& a) {
   return var(new internal::log1p_exp_v_vari(a.vi_));
 }
 
+/**
+ * Values and derivatives of log1p_exp over arrays of doubles,
+ * such that containers of <code>var</code> are differentiated with a
+ * single vari.
+ */
+template <>
+struct apply_scalar_unary_vectorized<log1p_exp_fun> : std::true_type {
+  template <typename T>
+  static inline auto value(const T& x) {
+    return log1p_exp(x);
+  }
+  template <typename T1, typename T2>
+  static inline auto derivative(const T1& x, const T2& fx) {
+    return inv_logit(x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
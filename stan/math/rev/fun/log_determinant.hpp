@@ -12,6 +12,7 @@ namespace math {
 
 template <int R, int C>
 inline var log_determinant(const Eigen::Matrix<var, R, C>& m) {
+  profile_scope profile("log_determinant");
   using Eigen::Matrix;
 
   math::check_square("log_determinant", "m", m);
@@ -0,0 +1,111 @@
+#ifndef STAN_MATH_REV_FUN_MATRIX_EXP_HPP
+#define STAN_MATH_REV_FUN_MATRIX_EXP_HPP
+
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/fun/typedefs.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_exp.hpp>
+#include <stan/math/prim/fun/typedefs.hpp>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Return the Frechet derivative of the matrix exponential at A in the
+ * direction E, which is the upper right block of the exponential of the
+ * block triangular matrix [A, E; 0, A].
+ *
+ * Reference: Nicholas J. Higham. Functions of Matrices: Theory and
+ * Computation. SIAM, 2008. Section 3.2.
+ *
+ * @param A square matrix
+ * @param E direction, a matrix of the same size as A
+ * @return Frechet derivative of exp at A in the direction E
+ */
+inline matrix_d matrix_exp_frechet(const matrix_d& A, const matrix_d& E) {
+  const int N = A.rows();
+  // the derivative is linear in E, which is scaled to unit size such that
+  // it does not dominate the scaling and squaring of the exponential
+  const double E_scale = E.cwiseAbs().maxCoeff();
+  if (E_scale == 0) {
+    return matrix_d::Zero(N, N);
+  }
+  matrix_d block = matrix_d::Zero(2 * N, 2 * N);
+  block.topLeftCorner(N, N) = A;
+  block.topRightCorner(N, N) = E / E_scale;
+  block.bottomRightCorner(N, N) = A;
+  return E_scale * matrix_exp(block).topRightCorner(N, N);
+}
+
+class matrix_exp_vari : public vari {
+ public:
+  int M_;  // A.rows() = A.cols()
+  double* A_;
+  vari** vari_ref_A_;
+  vari** vari_ref_exp_A_;
+
+  explicit matrix_exp_vari(const matrix_v& A)
+      : vari(0.0),
+        M_(A.rows()),
+        A_(ChainableStack::instance_->memalloc_.alloc_array<double>(A.size())),
+        vari_ref_A_(
+            ChainableStack::instance_->memalloc_.alloc_array<vari*>(A.size())),
+        vari_ref_exp_A_(
+            ChainableStack::instance_->memalloc_.alloc_array<vari*>(A.size())) {
+    using Eigen::Map;
+
+    Map<matrix_d> Ad(A_, M_, M_);
+    Ad = A.val();
+    Map<matrix_vi>(vari_ref_A_, M_, M_) = A.vi();
+    Map<matrix_vi>(vari_ref_exp_A_, M_, M_)
+        = matrix_exp(Ad).unaryExpr([](double x) { return new vari(x, false); });
+  }
+
+  /**
+   * The adjoint of A is the Frechet derivative of the matrix
+   * exponential at A' in the direction of the adjoint of exp(A).
+   */
+  virtual void chain() {
+    using Eigen::Map;
+
+    const matrix_d adj_exp_A = Map<matrix_vi>(vari_ref_exp_A_, M_, M_).adj();
+    Map<matrix_vi>(vari_ref_A_, M_, M_).adj() += matrix_exp_frechet(
+        Map<matrix_d>(A_, M_, M_).transpose(), adj_exp_A);
+  }
+};
+}  // namespace internal
+
+/**
+ * Return the matrix exponential of the input matrix. The value is
+ * calculated in double precision and the adjoint of the input matrix
+ * is the Frechet derivative of the matrix exponential, such that no
+ * expression graph of the Pade approximation is created.
+ *
+ * @tparam T type of the matrix
+ * @param[in] A_in Matrix to exponentiate.
+ * @return Matrix exponential, dynamically-sized.
+ * @throw <code>std::invalid_argument</code> if the input matrix
+ * is not square.
+ */
+template <typename T, require_eigen_vt<is_var, T>* = nullptr>
+inline plain_type_t<T> matrix_exp(const T& A_in) {
+  profile_scope profile("matrix_exp");
+  check_square("matrix_exp", "input matrix", A_in);
+  if (A_in.size() == 0) {
+    return {};
+  }
+
+  const matrix_v A = A_in;
+  auto* baseVari = new internal::matrix_exp_vari(A);
+  matrix_v res(A.rows(), A.cols());
+  res.vi() = Eigen::Map<matrix_vi>(baseVari->vari_ref_exp_A_, res.rows(),
+                                   res.cols());
+  return res;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -3,16 +3,162 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/matrix_exp.hpp>
 #include <stan/math/rev/fun/multiply.hpp>
+#include <stan/math/rev/fun/typedefs.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/matrix_exp.hpp>
+#include <stan/math/prim/fun/matrix_exp_action_handler.hpp>
+#include <stan/math/prim/fun/typedefs.hpp>
 
 namespace stan {
 namespace math {
 
+namespace internal {
 /**
- * Wrapper of matrix_exp_action function for a more literal name
+ * The vari of exp(A) * B, for which only the action of the matrix
+ * exponential on B is calculated and exp(A) itself is never formed.
+ *
+ * @tparam Ta scalar type of matrix A, double or var
+ * @tparam Tb scalar type of matrix B, double or var
+ */
+template <typename Ta, typename Tb>
+class matrix_exp_multiply_vari : public vari {
+ public:
+  int N_;  // A.rows() = A.cols() = B.rows()
+  int M_;  // B.cols()
+  double* A_;
+  double* B_;
+  vari** vari_ref_A_;
+  vari** vari_ref_B_;
+  vari** vari_ref_res_;
+
+  matrix_exp_multiply_vari(const Eigen::Matrix<Ta, -1, -1>& A,
+                           const Eigen::Matrix<Tb, -1, -1>& B)
+      : vari(0.0),
+        N_(A.rows()),
+        M_(B.cols()),
+        A_(ChainableStack::instance_->memalloc_.alloc_array<double>(A.size())),
+        B_(ChainableStack::instance_->memalloc_.alloc_array<double>(B.size())),
+        vari_ref_A_(is_var<Ta>::value
+                        ? ChainableStack::instance_->memalloc_
+                              .alloc_array<vari*>(A.size())
+                        : nullptr),
+        vari_ref_B_(is_var<Tb>::value
+                        ? ChainableStack::instance_->memalloc_
+                              .alloc_array<vari*>(B.size())
+                        : nullptr),
+        vari_ref_res_(
+            ChainableStack::instance_->memalloc_.alloc_array<vari*>(B.size())) {
+    using Eigen::Map;
+
+    Map<matrix_d> Ad(A_, N_, N_);
+    Map<matrix_d> Bd(B_, N_, M_);
+    Ad = value_of(A);
+    Bd = value_of(B);
+    if (is_var<Ta>::value) {
+      Map<matrix_vi>(vari_ref_A_, N_, N_) = vi_of(A);
+    }
+    if (is_var<Tb>::value) {
+      Map<matrix_vi>(vari_ref_B_, N_, M_) = vi_of(B);
+    }
+    Map<matrix_vi>(vari_ref_res_, N_, M_)
+        = matrix_exp_action_handler().action(Ad, Bd).unaryExpr(
+            [](double x) { return new vari(x, false); });
+  }
+
+  /**
+   * The adjoint of B is exp(A') times the adjoint of the result and the
+   * adjoint of A is the Frechet derivative of the matrix exponential at
+   * A' in the direction of the adjoint of the result times B'. The
+   * latter is the upper block of the action of the exponential of the
+   * block triangular matrix [A', E; 0, A'] on [0; I], whose lower block
+   * is exp(A'). The direction is scaled to unit size for the action, as
+   * in <code>matrix_exp_frechet()</code>, such that it does not
+   * dominate the scaling and squaring of the block matrix.
+   */
+  virtual void chain() {
+    using Eigen::Map;
+
+    const matrix_d adj_res = Map<matrix_vi>(vari_ref_res_, N_, M_).adj();
+    Map<matrix_d> Ad(A_, N_, N_);
+    Map<matrix_d> Bd(B_, N_, M_);
+
+    if (is_var<Ta>::value) {
+      const matrix_d E = adj_res * Bd.transpose();
+      const double E_scale = E.cwiseAbs().maxCoeff();
+      if (E_scale != 0) {
+        matrix_d block = matrix_d::Zero(2 * N_, 2 * N_);
+        block.topLeftCorner(N_, N_) = Ad.transpose();
+        block.topRightCorner(N_, N_) = E / E_scale;
+        block.bottomRightCorner(N_, N_) = Ad.transpose();
+        matrix_d unit = matrix_d::Zero(2 * N_, N_);
+        unit.bottomRows(N_).setIdentity();
+        const matrix_d exp_block_unit
+            = matrix_exp_action_handler().action(block, unit);
+
+        Map<matrix_vi>(vari_ref_A_, N_, N_).adj()
+            += E_scale * exp_block_unit.topRows(N_);
+        if (is_var<Tb>::value) {
+          Map<matrix_vi>(vari_ref_B_, N_, M_).adj()
+              += exp_block_unit.bottomRows(N_) * adj_res;
+        }
+        return;
+      }
+    }
+
+    // A is data or the adjoint of A is zero
+    if (is_var<Tb>::value) {
+      Map<matrix_vi>(vari_ref_B_, N_, M_).adj()
+          += matrix_exp_action_handler().action(Ad.transpose(), adj_res);
+    }
+  }
+
+ private:
+  template <typename T>
+  static matrix_vi vi_of(const Eigen::Matrix<T, -1, -1>& x) {
+    return x.vi();
+  }
+  static matrix_vi vi_of(const matrix_d& x) { return {}; }
+};
+}  // namespace internal
+
+/**
+ * Return exp(A) * B for reverse mode autodiff variables. The value is
+ * calculated with the action of the matrix exponential on B in double
+ * precision and a single vari calculates the adjoints of A and B.
+ *
+ * @tparam Ta scalar type matrix A, double or var
+ * @tparam Tb scalar type matrix B, double or var
+ * @tparam Cb Columns matrix B
+ *
+ * @param[in] A Matrix
+ * @param[in] B Matrix
+ * @return exponential of A multiplies B
+ */
+template <typename Ta, typename Tb, int Cb,
+          require_all_var_or_arithmetic_t<Ta, Tb>* = nullptr,
+          require_any_var_t<Ta, Tb>* = nullptr>
+inline Eigen::Matrix<var, -1, Cb> matrix_exp_multiply(
+    const Eigen::Matrix<Ta, -1, -1>& A, const Eigen::Matrix<Tb, -1, Cb>& B) {
+  profile_scope profile("matrix_exp_multiply");
+  check_square("matrix_exp_multiply", "input matrix", A);
+  check_multiplicable("matrix_exp_multiply", "A", A, "B", B);
+  if (A.size() == 0) {
+    return {0, B.cols()};
+  }
+
+  const Eigen::Matrix<Tb, -1, -1> B_dyn = B;
+  auto* baseVari = new internal::matrix_exp_multiply_vari<Ta, Tb>(A, B_dyn);
+  Eigen::Matrix<var, -1, Cb> res(B.rows(), B.cols());
+  res.vi() = Eigen::Map<matrix_vi>(baseVari->vari_ref_res_, res.rows(),
+                                   res.cols());
+  return res;
+}
+
+/**
+ * Return exp(A) * B for forward mode autodiff variables.
  *
  * @tparam Ta scalar type matrix A
  * @tparam Tb scalar type matrix B
@@ -22,7 +168,8 @@ namespace math {
  * @param[in] B Matrix
  * @return exponential of A multiplies B
  */
-template <typename Ta, typename Tb, int Cb>
+template <typename Ta, typename Tb, int Cb,
+          require_any_fvar_t<Ta, Tb>* = nullptr>
 inline Eigen::Matrix<return_type_t<Ta, Tb>, -1, Cb> matrix_exp_multiply(
     const Eigen::Matrix<Ta, -1, -1>& A, const Eigen::Matrix<Tb, -1, Cb>& B) {
   check_square("matrix_exp_multiply", "input matrix", A);
@@ -29,16 +29,11 @@ namespace math {
 template <typename Ta, int Ra, int Ca, typename Tb, int Cb>
 class multiply_mat_vari : public vari {
  public:
-  int A_rows_;
-  int A_cols_;
-  int B_cols_;
-  int A_size_;
-  int B_size_;
-  double* Ad_;
-  double* Bd_;
-  vari** variRefA_;
-  vari** variRefB_;
-  vari** variRefAB_;
+  arena_matrix<Eigen::Matrix<double, Ra, Ca>> Ad_;
+  arena_matrix<Eigen::Matrix<double, Ca, Cb>> Bd_;
+  arena_matrix<Eigen::Matrix<vari*, Ra, Ca>> variRefA_;
+  arena_matrix<Eigen::Matrix<vari*, Ca, Cb>> variRefB_;
+  arena_matrix<Eigen::Matrix<vari*, Ra, Cb>> variRefAB_;
 
   /**
    * Constructor for multiply_mat_vari.
@@ -59,72 +54,49 @@ class multiply_mat_vari : public vari {
   multiply_mat_vari(const Eigen::Matrix<Ta, Ra, Ca>& A,
                     const Eigen::Matrix<Tb, Ca, Cb>& B)
       : vari(0.0),
-        A_rows_(A.rows()),
-        A_cols_(A.cols()),
-        B_cols_(B.cols()),
-        A_size_(A.size()),
-        B_size_(B.size()),
-        Ad_(ChainableStack::instance_->memalloc_.alloc_array<double>(A_size_)),
-        Bd_(ChainableStack::instance_->memalloc_.alloc_array<double>(B_size_)),
-        variRefA_(
-            ChainableStack::instance_->memalloc_.alloc_array<vari*>(A_size_)),
-        variRefB_(
-            ChainableStack::instance_->memalloc_.alloc_array<vari*>(B_size_)),
-        variRefAB_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
-            A_rows_ * B_cols_)) {
-    using Eigen::Map;
-    Map<matrix_vi>(variRefA_, A_rows_, A_cols_) = A.vi();
-    Map<matrix_vi>(variRefB_, A_cols_, B_cols_) = B.vi();
-    Map<matrix_d> Ad(Ad_, A_rows_, A_cols_);
-    Map<matrix_d> Bd(Bd_, A_cols_, B_cols_);
-    Ad = A.val();
-    Bd = B.val();
+        Ad_(A.val()),
+        Bd_(B.val()),
+        variRefA_(A.vi()),
+        variRefB_(B.vi()) {
 #ifdef STAN_OPENCL
-    if (Ad.rows() * Ad.cols() * Bd.cols()
+    if (Ad_.rows() * Ad_.cols() * Bd_.cols()
         > opencl_context.tuning_opts().multiply_dim_prod_worth_transfer) {
-      matrix_cl<double> Ad_cl(Ad);
-      matrix_cl<double> Bd_cl(Bd);
+      matrix_cl<double> Ad_cl(Ad_.data(), Ad_.rows(), Ad_.cols());
+      matrix_cl<double> Bd_cl(Bd_.data(), Bd_.rows(), Bd_.cols());
       matrix_cl<double> variRefAB_cl = Ad_cl * Bd_cl;
       matrix_d temp = from_matrix_cl(variRefAB_cl);
-      Map<matrix_vi>(variRefAB_, A_rows_, B_cols_)
-          = temp.unaryExpr([](double x) { return new vari(x, false); });
+      variRefAB_ = temp.unaryExpr([](double x) { return new vari(x, false); });
     } else {
-      Map<matrix_vi>(variRefAB_, A_rows_, B_cols_)
-          = (Ad * Bd).unaryExpr([](double x) { return new vari(x, false); });
+      variRefAB_
+          = (Ad_ * Bd_).unaryExpr([](double x) { return new vari(x, false); });
     }
 #else
-    Map<matrix_vi>(variRefAB_, A_rows_, B_cols_)
-        = (Ad * Bd).unaryExpr([](double x) { return new vari(x, false); });
+    variRefAB_
+        = (Ad_ * Bd_).unaryExpr([](double x) { return new vari(x, false); });
 #endif
   }
 
   virtual void chain() {
-    using Eigen::Map;
-    matrix_d adjAB(A_rows_, B_cols_);
-    adjAB = Map<matrix_vi>(variRefAB_, A_rows_, B_cols_).adj();
+    matrix_d adjAB = variRefAB_.adj();
 #ifdef STAN_OPENCL
-    if (A_rows_ * A_cols_ * B_cols_
+    if (Ad_.rows() * Ad_.cols() * Bd_.cols()
         > opencl_context.tuning_opts().multiply_dim_prod_worth_transfer) {
       matrix_cl<double> adjAB_cl(adjAB);
-      matrix_cl<double> Ad_cl(Ad_, A_rows_, A_cols_);
-      matrix_cl<double> Bd_cl(Bd_, A_cols_, B_cols_);
+      matrix_cl<double> Ad_cl(Ad_.data(), Ad_.rows(), Ad_.cols());
+      matrix_cl<double> Bd_cl(Bd_.data(), Bd_.rows(), Bd_.cols());
       matrix_cl<double> variRefA_cl = adjAB_cl * transpose(Bd_cl);
       matrix_cl<double> variRefB_cl = transpose(Ad_cl) * adjAB_cl;
       matrix_d temp_variRefA = from_matrix_cl(variRefA_cl);
       matrix_d temp_variRefB = from_matrix_cl(variRefB_cl);
-      Map<matrix_vi>(variRefA_, A_rows_, A_cols_).adj() += temp_variRefA;
-      Map<matrix_vi>(variRefB_, A_cols_, B_cols_).adj() += temp_variRefB;
+      variRefA_.adj() += temp_variRefA;
+      variRefB_.adj() += temp_variRefB;
     } else {
-      Map<matrix_vi>(variRefA_, A_rows_, A_cols_).adj()
-          += adjAB * Map<matrix_d>(Bd_, A_cols_, B_cols_).transpose();
-      Map<matrix_vi>(variRefB_, A_cols_, B_cols_).adj()
-          += Map<matrix_d>(Ad_, A_rows_, A_cols_).transpose() * adjAB;
+      variRefA_.adj() += adjAB * Bd_.transpose();
+      variRefB_.adj() += Ad_.transpose() * adjAB;
     }
 #else
-    Map<matrix_vi>(variRefA_, A_rows_, A_cols_).adj()
-        += adjAB * Map<matrix_d>(Bd_, A_cols_, B_cols_).transpose();
-    Map<matrix_vi>(variRefB_, A_cols_, B_cols_).adj()
-        += Map<matrix_d>(Ad_, A_rows_, A_cols_).transpose() * adjAB;
+    variRefA_.adj() += adjAB * Bd_.transpose();
+    variRefB_.adj() += Ad_.transpose() * adjAB;
 #endif
   }
 };
@@ -147,11 +119,10 @@ class multiply_mat_vari : public vari {
 template <typename Ta, int Ca, typename Tb>
 class multiply_mat_vari<Ta, 1, Ca, Tb, 1> : public vari {
  public:
-  int size_;
-  double* Ad_;
-  double* Bd_;
-  vari** variRefA_;
-  vari** variRefB_;
+  arena_matrix<Eigen::Matrix<double, 1, Ca>> Ad_;
+  arena_matrix<Eigen::Matrix<double, Ca, 1>> Bd_;
+  arena_matrix<Eigen::Matrix<vari*, 1, Ca>> variRefA_;
+  arena_matrix<Eigen::Matrix<vari*, Ca, 1>> variRefB_;
   vari* variRefAB_;
 
   /**
@@ -173,30 +144,16 @@ class multiply_mat_vari<Ta, 1, Ca, Tb, 1> : public vari {
   multiply_mat_vari(const Eigen::Matrix<Ta, 1, Ca>& A,
                     const Eigen::Matrix<Tb, Ca, 1>& B)
       : vari(0.0),
-        size_(A.cols()),
-        Ad_(ChainableStack::instance_->memalloc_.alloc_array<double>(size_)),
-        Bd_(ChainableStack::instance_->memalloc_.alloc_array<double>(size_)),
-        variRefA_(
-            ChainableStack::instance_->memalloc_.alloc_array<vari*>(size_)),
-        variRefB_(
-            ChainableStack::instance_->memalloc_.alloc_array<vari*>(size_)) {
-    using Eigen::Map;
-    Map<row_vector_vi>(variRefA_, size_) = A.vi();
-    Map<vector_vi>(variRefB_, size_) = B.vi();
-    Map<row_vector_d> Ad(Ad_, size_);
-    Map<vector_d> Bd(Bd_, size_);
-    Ad = A.val();
-    Bd = B.val();
-
-    variRefAB_ = new vari(Ad * Bd, false);
-  }
+        Ad_(A.val()),
+        Bd_(B.val()),
+        variRefA_(A.vi()),
+        variRefB_(B.vi()),
+        variRefAB_(new vari(Ad_ * Bd_, false)) {}
 
   virtual void chain() {
-    using Eigen::Map;
-
     double adjAB = variRefAB_->adj_;
-    Map<vector_vi>(variRefA_, size_).adj() += adjAB * Map<vector_d>(Bd_, size_);
-    Map<vector_vi>(variRefB_, size_).adj() += Map<vector_d>(Ad_, size_) * adjAB;
+    variRefA_.adj() += adjAB * Bd_.transpose();
+    variRefB_.adj() += Ad_.transpose() * adjAB;
   }
 };
 
@@ -219,15 +176,10 @@ class multiply_mat_vari<Ta, 1, Ca, Tb, 1> : public vari {
 template <int Ra, int Ca, typename Tb, int Cb>
 class multiply_mat_vari<double, Ra, Ca, Tb, Cb> : public vari {
  public:
-  int A_rows_;
-  int A_cols_;
-  int B_cols_;
-  int A_size_;
-  int B_size_;
-  double* Ad_;
-  double* Bd_;
-  vari** variRefB_;
-  vari** variRefAB_;
+  arena_matrix<Eigen::Matrix<double, Ra, Ca>> Ad_;
+  arena_matrix<Eigen::Matrix<double, Ca, Cb>> Bd_;
+  arena_matrix<Eigen::Matrix<vari*, Ca, Cb>> variRefB_;
+  arena_matrix<Eigen::Matrix<vari*, Ra, Cb>> variRefAB_;
 
   /**
    * Constructor for multiply_mat_vari.
@@ -247,61 +199,40 @@ class multiply_mat_vari<double, Ra, Ca, Tb, Cb> : public vari {
    */
   multiply_mat_vari(const Eigen::Matrix<double, Ra, Ca>& A,
                     const Eigen::Matrix<Tb, Ca, Cb>& B)
-      : vari(0.0),
-        A_rows_(A.rows()),
-        A_cols_(A.cols()),
-        B_cols_(B.cols()),
-        A_size_(A.size()),
-        B_size_(B.size()),
-        Ad_(ChainableStack::instance_->memalloc_.alloc_array<double>(A_size_)),
-        Bd_(ChainableStack::instance_->memalloc_.alloc_array<double>(B_size_)),
-        variRefB_(
-            ChainableStack::instance_->memalloc_.alloc_array<vari*>(B_size_)),
-        variRefAB_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
-            A_rows_ * B_cols_)) {
-    using Eigen::Map;
-    Map<matrix_vi>(variRefB_, A_cols_, B_cols_) = B.vi();
-    Map<matrix_d> Ad(Ad_, A_rows_, A_cols_);
-    Map<matrix_d> Bd(Bd_, A_cols_, B_cols_);
-    Ad = A;
-    Bd = B.val();
+      : vari(0.0), Ad_(A), Bd_(B.val()), variRefB_(B.vi()) {
 #ifdef STAN_OPENCL
-    if (Ad.rows() * Ad.cols() * Bd.cols()
+    if (Ad_.rows() * Ad_.cols() * Bd_.cols()
         > opencl_context.tuning_opts().multiply_dim_prod_worth_transfer) {
-      matrix_cl<double> Ad_cl(Ad);
-      matrix_cl<double> Bd_cl(Bd);
+      matrix_cl<double> Ad_cl(Ad_.data(), Ad_.rows(), Ad_.cols());
+      matrix_cl<double> Bd_cl(Bd_.data(), Bd_.rows(), Bd_.cols());
       matrix_cl<double> variRefAB_cl = Ad_cl * Bd_cl;
       matrix_d temp = from_matrix_cl(variRefAB_cl);
-      Map<matrix_vi>(variRefAB_, A_rows_, B_cols_)
-          = temp.unaryExpr([](double x) { return new vari(x, false); });
+      variRefAB_ = temp.unaryExpr([](double x) { return new vari(x, false); });
     } else {
-      Map<matrix_vi>(variRefAB_, A_rows_, B_cols_)
-          = (Ad * Bd).unaryExpr([](double x) { return new vari(x, false); });
+      variRefAB_
+          = (Ad_ * Bd_).unaryExpr([](double x) { return new vari(x, false); });
     }
 #else
-    Map<matrix_vi>(variRefAB_, A_rows_, B_cols_)
-        = (Ad * Bd).unaryExpr([](double x) { return new vari(x, false); });
+    variRefAB_
+        = (Ad_ * Bd_).unaryExpr([](double x) { return new vari(x, false); });
 #endif
   }
 
   virtual void chain() {
-    using Eigen::Map;
-    matrix_d adjAB = Map<matrix_vi>(variRefAB_, A_rows_, B_cols_).adj();
+    matrix_d adjAB = variRefAB_.adj();
 #ifdef STAN_OPENCL
-    if (A_rows_ * A_cols_ * B_cols_
+    if (Ad_.rows() * Ad_.cols() * Bd_.cols()
         > opencl_context.tuning_opts().multiply_dim_prod_worth_transfer) {
       matrix_cl<double> adjAB_cl(adjAB);
-      matrix_cl<double> Ad_cl(Ad_, A_rows_, A_cols_);
+      matrix_cl<double> Ad_cl(Ad_.data(), Ad_.rows(), Ad_.cols());
       matrix_cl<double> variRefB_cl = transpose(Ad_cl) * adjAB_cl;
       matrix_d temp_variRefB = from_matrix_cl(variRefB_cl);
-      Map<matrix_vi>(variRefB_, A_cols_, B_cols_).adj() += temp_variRefB;
+      variRefB_.adj() += temp_variRefB;
     } else {
-      Map<matrix_vi>(variRefB_, A_cols_, B_cols_).adj()
-          += Map<matrix_d>(Ad_, A_rows_, A_cols_).transpose() * adjAB;
+      variRefB_.adj() += Ad_.transpose() * adjAB;
     }
 #else
-    Map<matrix_vi>(variRefB_, A_cols_, B_cols_).adj()
-        += Map<matrix_d>(Ad_, A_rows_, A_cols_).transpose() * adjAB;
+    variRefB_.adj() += Ad_.transpose() * adjAB;
 #endif
   }
 };
@@ -324,10 +255,9 @@ class multiply_mat_vari<double, Ra, Ca, Tb, Cb> : public vari {
 template <int Ca, typename Tb>
 class multiply_mat_vari<double, 1, Ca, Tb, 1> : public vari {
  public:
-  int size_;
-  double* Ad_;
-  double* Bd_;
-  vari** variRefB_;
+  arena_matrix<Eigen::Matrix<double, 1, Ca>> Ad_;
+  arena_matrix<Eigen::Matrix<double, Ca, 1>> Bd_;
+  arena_matrix<Eigen::Matrix<vari*, Ca, 1>> variRefB_;
   vari* variRefAB_;
 
   /**
@@ -349,24 +279,13 @@ class multiply_mat_vari<double, 1, Ca, Tb, 1> : public vari {
   multiply_mat_vari(const Eigen::Matrix<double, 1, Ca>& A,
                     const Eigen::Matrix<Tb, Ca, 1>& B)
       : vari(0.0),
-        size_(A.cols()),
-        Ad_(ChainableStack::instance_->memalloc_.alloc_array<double>(size_)),
-        Bd_(ChainableStack::instance_->memalloc_.alloc_array<double>(size_)),
-        variRefB_(
-            ChainableStack::instance_->memalloc_.alloc_array<vari*>(size_)) {
-    using Eigen::Map;
-    Map<row_vector_d> Ad(Ad_, size_);
-    Map<vector_d> Bd(Bd_, size_);
-    Map<vector_vi>(variRefB_, size_) = B.vi();
-    Ad = A;
-    Bd = B.val();
-    variRefAB_ = new vari(Ad * Bd, false);
-  }
+        Ad_(A),
+        Bd_(B.val()),
+        variRefB_(B.vi()),
+        variRefAB_(new vari(Ad_ * Bd_, false)) {}
 
   virtual void chain() {
-    using Eigen::Map;
-    Map<vector_vi>(variRefB_, size_).adj()
-        += Map<vector_d>(Ad_, size_) * variRefAB_->adj_;
+    variRefB_.adj() += Ad_.transpose() * variRefAB_->adj_;
   }
 };
 
@@ -389,15 +308,10 @@ class multiply_mat_vari<double, 1, Ca, Tb, 1> : public vari {
 template <typename Ta, int Ra, int Ca, int Cb>
 class multiply_mat_vari<Ta, Ra, Ca, double, Cb> : public vari {
  public:
-  int A_rows_;
-  int A_cols_;
-  int B_cols_;
-  int A_size_;
-  int B_size_;
-  double* Ad_;
-  double* Bd_;
-  vari** variRefA_;
-  vari** variRefAB_;
+  arena_matrix<Eigen::Matrix<double, Ra, Ca>> Ad_;
+  arena_matrix<Eigen::Matrix<double, Ca, Cb>> Bd_;
+  arena_matrix<Eigen::Matrix<vari*, Ra, Ca>> variRefA_;
+  arena_matrix<Eigen::Matrix<vari*, Ra, Cb>> variRefAB_;
 
   /**
    * Constructor for multiply_mat_vari.
@@ -417,61 +331,40 @@ class multiply_mat_vari<Ta, Ra, Ca, double, Cb> : public vari {
    */
   multiply_mat_vari(const Eigen::Matrix<Ta, Ra, Ca>& A,
                     const Eigen::Matrix<double, Ca, Cb>& B)
-      : vari(0.0),
-        A_rows_(A.rows()),
-        A_cols_(A.cols()),
-        B_cols_(B.cols()),
-        A_size_(A.size()),
-        B_size_(B.size()),
-        Ad_(ChainableStack::instance_->memalloc_.alloc_array<double>(A_size_)),
-        Bd_(ChainableStack::instance_->memalloc_.alloc_array<double>(B_size_)),
-        variRefA_(
-            ChainableStack::instance_->memalloc_.alloc_array<vari*>(A_size_)),
-        variRefAB_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
-            A_rows_ * B_cols_)) {
-    using Eigen::Map;
-    Map<matrix_vi>(variRefA_, A_rows_, A_cols_) = A.vi();
-    Map<matrix_d> Ad(Ad_, A_rows_, A_cols_);
-    Map<matrix_d> Bd(Bd_, A_cols_, B_cols_);
-    Ad = A.val();
-    Bd = B.val();
+      : vari(0.0), Ad_(A.val()), Bd_(B), variRefA_(A.vi()) {
 #ifdef STAN_OPENCL
-    if (Ad.rows() * Ad.cols() * Bd.cols()
+    if (Ad_.rows() * Ad_.cols() * Bd_.cols()
         > opencl_context.tuning_opts().multiply_dim_prod_worth_transfer) {
-      matrix_cl<double> Ad_cl(Ad);
-      matrix_cl<double> Bd_cl(Bd);
+      matrix_cl<double> Ad_cl(Ad_.data(), Ad_.rows(), Ad_.cols());
+      matrix_cl<double> Bd_cl(Bd_.data(), Bd_.rows(), Bd_.cols());
       matrix_cl<double> variRefAB_cl = Ad_cl * Bd_cl;
       matrix_d temp = from_matrix_cl(variRefAB_cl);
-      Map<matrix_vi>(variRefAB_, A_rows_, B_cols_)
-          = temp.unaryExpr([](double x) { return new vari(x, false); });
+      variRefAB_ = temp.unaryExpr([](double x) { return new vari(x, false); });
     } else {
-      Map<matrix_vi>(variRefAB_, A_rows_, B_cols_)
-          = (Ad * Bd).unaryExpr([](double x) { return new vari(x, false); });
+      variRefAB_
+          = (Ad_ * Bd_).unaryExpr([](double x) { return new vari(x, false); });
     }
 #else
-    Map<matrix_vi>(variRefAB_, A_rows_, B_cols_)
-        = (Ad * Bd).unaryExpr([](double x) { return new vari(x, false); });
+    variRefAB_
+        = (Ad_ * Bd_).unaryExpr([](double x) { return new vari(x, false); });
 #endif
   }
 
   virtual void chain() {
-    using Eigen::Map;
-    matrix_d adjAB = Map<matrix_vi>(variRefAB_, A_rows_, B_cols_).adj();
+    matrix_d adjAB = variRefAB_.adj();
 #ifdef STAN_OPENCL
-    if (A_rows_ * A_cols_ * B_cols_
+    if (Ad_.rows() * Ad_.cols() * Bd_.cols()
         > opencl_context.tuning_opts().multiply_dim_prod_worth_transfer) {
       matrix_cl<double> adjAB_cl(adjAB);
-      matrix_cl<double> Bd_cl(Bd_, A_cols_, B_cols_);
+      matrix_cl<double> Bd_cl(Bd_.data(), Bd_.rows(), Bd_.cols());
       matrix_cl<double> variRefA_cl = adjAB_cl * transpose(Bd_cl);
       matrix_d temp_variRefA = from_matrix_cl(variRefA_cl);
-      Map<matrix_vi>(variRefA_, A_rows_, A_cols_).adj() += temp_variRefA;
+      variRefA_.adj() += temp_variRefA;
     } else {
-      Map<matrix_vi>(variRefA_, A_rows_, A_cols_).adj()
-          += adjAB * Map<matrix_d>(Bd_, A_cols_, B_cols_).transpose();
+      variRefA_.adj() += adjAB * Bd_.transpose();
     }
 #else
-    Map<matrix_vi>(variRefA_, A_rows_, A_cols_).adj()
-        += adjAB * Map<matrix_d>(Bd_, A_cols_, B_cols_).transpose();
+    variRefA_.adj() += adjAB * Bd_.transpose();
 #endif
   }
 };
@@ -494,10 +387,9 @@ class multiply_mat_vari<Ta, Ra, Ca, double, Cb> : public vari {
 template <typename Ta, int Ca>
 class multiply_mat_vari<Ta, 1, Ca, double, 1> : public vari {
  public:
-  int size_;
-  double* Ad_;
-  double* Bd_;
-  vari** variRefA_;
+  arena_matrix<Eigen::Matrix<double, 1, Ca>> Ad_;
+  arena_matrix<Eigen::Matrix<double, Ca, 1>> Bd_;
+  arena_matrix<Eigen::Matrix<vari*, 1, Ca>> variRefA_;
   vari* variRefAB_;
 
   /**
@@ -519,26 +411,13 @@ class multiply_mat_vari<Ta, 1, Ca, double, 1> : public vari {
   multiply_mat_vari(const Eigen::Matrix<Ta, 1, Ca>& A,
                     const Eigen::Matrix<double, Ca, 1>& B)
       : vari(0.0),
-        size_(A.cols()),
-        Ad_(ChainableStack::instance_->memalloc_.alloc_array<double>(size_)),
-        Bd_(ChainableStack::instance_->memalloc_.alloc_array<double>(size_)),
-        variRefA_(
-            ChainableStack::instance_->memalloc_.alloc_array<vari*>(size_)) {
-    using Eigen::Map;
-    Map<row_vector_vi>(variRefA_, size_) = A.vi();
-    Map<row_vector_d> Ad(Ad_, size_);
-    Map<vector_d> Bd(Bd_, size_);
-    Ad = A.val();
-    Bd = B;
-
-    variRefAB_ = new vari(Ad * Bd, false);
-  }
+        Ad_(A.val()),
+        Bd_(B),
+        variRefA_(A.vi()),
+        variRefAB_(new vari(Ad_ * Bd_, false)) {}
 
   virtual void chain() {
-    using Eigen::Map;
-
-    Map<row_vector_vi>(variRefA_, size_).adj()
-        += variRefAB_->adj_ * Map<row_vector_d>(Bd_, size_);
+    variRefA_.adj() += variRefAB_->adj_ * Bd_.transpose();
   }
 };
 
@@ -557,6 +436,7 @@ template <typename Mat1, typename Mat2,
           require_any_eigen_vt<is_var, Mat1, Mat2>* = nullptr,
           require_not_eigen_row_and_col_t<Mat1, Mat2>* = nullptr>
 inline auto multiply(const Mat1& A, const Mat2& B) {
+  profile_scope profile("multiply");
   using Ta = value_type_t<Mat1>;
   using Tb = value_type_t<Mat2>;
   constexpr int Ra = Mat1::RowsAtCompileTime;
@@ -570,8 +450,7 @@ inline auto multiply(const Mat1& A, const Mat2& B) {
   multiply_mat_vari<Ta, Ra, Ca, Tb, Cb>* baseVari
       = new multiply_mat_vari<Ta, Ra, Ca, Tb, Cb>(A, B);
   Eigen::Matrix<var, Ra, Cb> AB_v(A.rows(), B.cols());
-  AB_v.vi()
-      = Eigen::Map<matrix_vi>(&baseVari->variRefAB_[0], A.rows(), B.cols());
+  AB_v.vi() = baseVari->variRefAB_;
 
   return AB_v;
 }
@@ -592,6 +471,7 @@ template <
     require_any_var_t<value_type_t<RowVec>, value_type_t<ColVec>>* = nullptr,
     require_eigen_row_and_col_t<RowVec, ColVec>* = nullptr>
 inline var multiply(const RowVec& A, const ColVec& B) {
+  profile_scope profile("multiply");
   using RowVecScalar = value_type_t<RowVec>;
   using ColVecScalar = value_type_t<ColVec>;
   constexpr int Ca = RowVec::ColsAtCompileTime;
@@ -607,6 +487,39 @@ inline var multiply(const RowVec& A, const ColVec& B) {
   return AB_v;
 }
 
+/**
+ * Return the product of two matrices, at least one of which is a
+ * matrix variable in struct-of-arrays form. The adjoints of the
+ * operands are updated with two dense matrix products in the reverse
+ * pass.
+ *
+ * @tparam T1 type of first matrix, a var_matrix or an Eigen type with
+ * arithmetic scalars
+ * @tparam T2 type of second matrix, a var_matrix or an Eigen type with
+ * arithmetic scalars
+ * @param[in] A Matrix
+ * @param[in] B Matrix
+ * @return Product of the matrices.
+ */
+template <typename T1, typename T2,
+          require_all_var_matrix_or_eigen_t<T1, T2>* = nullptr,
+          require_any_var_matrix_t<T1, T2>* = nullptr>
+inline auto multiply(const T1& A, const T2& B) {
+  profile_scope profile("multiply");
+  check_multiplicable("multiply", "A", internal::var_matrix_value(A), "B",
+                      internal::var_matrix_value(B));
+  check_not_nan("multiply", "m1", internal::var_matrix_value(A));
+  check_not_nan("multiply", "m2", internal::var_matrix_value(B));
+
+  internal::var_matrix_operand<T1> arena_A(A);
+  internal::var_matrix_operand<T2> arena_B(B);
+  return internal::make_var_matrix(
+      arena_A.val() * arena_B.val(), [arena_A, arena_B](const auto& adj) {
+        arena_A.add_adj(adj * arena_B.val().transpose());
+        arena_B.add_adj(arena_A.val().transpose() * adj);
+      });
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -61,6 +61,23 @@ inline std::complex<var> sqrt(const std::complex<var>& z) {
   return internal::complex_sqrt(z);
 }
 
+/**
+ * Values and derivatives of the square root over arrays of doubles,
+ * such that containers of <code>var</code> are differentiated with a
+ * single vari.
+ */
+template <>
+struct apply_scalar_unary_vectorized<sqrt_fun> : std::true_type {
+  template <typename T>
+  static inline auto value(const T& x) {
+    return sqrt(x);
+  }
+  template <typename T1, typename T2>
+  static inline auto derivative(const T1& x, const T2& fx) {
+    return 0.5 / fx;
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,46 @@
+#ifndef STAN_MATH_REV_FUN_SUBTRACT_HPP
+#define STAN_MATH_REV_FUN_SUBTRACT_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/subtract.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the difference of the specified matrices, at least one of which
+ * is a matrix variable in struct-of-arrays form. The values of
+ * arithmetic operands are not stored, as the reverse pass only needs
+ * the adjoints of the result.
+ *
+ * @tparam T1 type of the first matrix, a var_matrix or an Eigen type
+ * with arithmetic scalars
+ * @tparam T2 type of the second matrix, a var_matrix or an Eigen type
+ * with arithmetic scalars
+ * @param a First matrix.
+ * @param b Second matrix.
+ * @return The difference of the matrices.
+ * @throw std::invalid_argument if a and b are not the same size.
+ */
+template <typename T1, typename T2,
+          require_all_var_matrix_or_eigen_t<T1, T2>* = nullptr,
+          require_any_var_matrix_t<T1, T2>* = nullptr>
+inline auto subtract(const T1& a, const T2& b) {
+  check_matching_dims("subtract", "a", internal::var_matrix_value(a), "b",
+                      internal::var_matrix_value(b));
+  internal::var_matrix_operand<T1, false> arena_a(a);
+  internal::var_matrix_operand<T2, false> arena_b(b);
+  return internal::make_var_matrix(
+      internal::var_matrix_value(a) - internal::var_matrix_value(b),
+      [arena_a, arena_b](const auto& adj) {
+        arena_a.add_adj(adj);
+        arena_b.add_adj(-adj);
+      });
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -5,6 +5,7 @@
 #include <stan/math/rev/fun/value_of_rec.hpp>
 #include <stan/math/rev/core.hpp>
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/functor/coupled_ode_system.hpp>
 #include <stdexcept>
@@ -104,6 +105,11 @@ struct coupled_ode_system<F, double, var> {
    *
    * This method uses nested autodiff and is not thread safe.
    *
+   * The Jacobian of the base ODE RHS is computed with one nested
+   * reverse sweep per state. The sensitivity RHS is then formed as a
+   * single dense product of this Jacobian with the matrix of current
+   * sensitivities.
+   *
    * @param[in] z state of the coupled ode system; this must be size
    *   <code>size()</code>
    * @param[out] dz_dt a vector of size <code>size()</code> with the
@@ -126,21 +132,18 @@ struct coupled_ode_system<F, double, var> {
     check_size_match("coupled_ode_system", "dz_dt", dy_dt_vars.size(), "states",
                      N_);
 
+    Eigen::MatrixXd jacobian_y(N_, N_);
+    Eigen::MatrixXd jacobian_theta(N_, M_);
+
     for (size_t i = 0; i < N_; i++) {
       dz_dt[i] = dy_dt_vars[i].val();
       dy_dt_vars[i].grad();
 
+      for (size_t k = 0; k < N_; k++) {
+        jacobian_y.coeffRef(i, k) = y_vars[k].adj();
+      }
       for (size_t j = 0; j < M_; j++) {
-        // orders derivatives by equation (i.e. if there are 2 eqns
-        // (y1, y2) and 2 parameters (a, b), dy_dt will be ordered as:
-        // dy1_dt, dy2_dt, dy1_da, dy2_da, dy1_db, dy2_db
-        double temp_deriv = theta_nochain_[j].adj();
-        const size_t offset = N_ + N_ * j;
-        for (size_t k = 0; k < N_; k++) {
-          temp_deriv += z[offset + k] * y_vars[k].adj();
-        }
-
-        dz_dt[offset + i] = temp_deriv;
+        jacobian_theta.coeffRef(i, j) = theta_nochain_[j].adj();
       }
 
       nested.set_zero_all_adjoints();
@@ -152,6 +155,14 @@ struct coupled_ode_system<F, double, var> {
         theta_nochain_[j].vi_->set_zero_adjoint();
       }
     }
+
+    // orders derivatives by equation (i.e. if there are 2 eqns
+    // (y1, y2) and 2 parameters (a, b), dy_dt will be ordered as:
+    // dy1_dt, dy2_dt, dy1_da, dy2_da, dy1_db, dy2_db)
+    Eigen::Map<const Eigen::MatrixXd> sens(z.data() + N_, N_, M_);
+    Eigen::Map<Eigen::MatrixXd> dsens_dt(dz_dt.data() + N_, N_, M_);
+    dsens_dt.noalias() = jacobian_y * sens;
+    dsens_dt += jacobian_theta;
   }
 
   /**
@@ -256,6 +267,11 @@ struct coupled_ode_system<F, var, double> {
    *
    * This method uses nested autodiff and is not thread safe.
    *
+   * The Jacobian of the base ODE RHS is computed with one nested
+   * reverse sweep per state. The sensitivity RHS is then formed as a
+   * single dense product of this Jacobian with the matrix of current
+   * sensitivities.
+   *
    * @param[in] z state of the coupled ode system; this must be
    *   size <code>size()</code>
    * @param[out] dz_dt a vector of length size() with the
@@ -278,26 +294,26 @@ struct coupled_ode_system<F, var, double> {
     check_size_match("coupled_ode_system", "dz_dt", dy_dt_vars.size(), "states",
                      N_);
 
+    Eigen::MatrixXd jacobian_y(N_, N_);
+
     for (size_t i = 0; i < N_; i++) {
       dz_dt[i] = dy_dt_vars[i].val();
       dy_dt_vars[i].grad();
 
-      for (size_t j = 0; j < N_; j++) {
-        // orders derivatives by equation (i.e. if there are 2 eqns
-        // (y1, y2) and 2 initial conditions (y0_a, y0_b), dy_dt will be
-        // ordered as: dy1_dt, dy2_dt, dy1_d{y0_a}, dy2_d{y0_a}, dy1_d{y0_b},
-        // dy2_d{y0_b}
-        double temp_deriv = 0;
-        const size_t offset = N_ + N_ * j;
-        for (size_t k = 0; k < N_; k++) {
-          temp_deriv += z[offset + k] * y_vars[k].adj();
-        }
-
-        dz_dt[offset + i] = temp_deriv;
+      for (size_t k = 0; k < N_; k++) {
+        jacobian_y.coeffRef(i, k) = y_vars[k].adj();
       }
 
       nested.set_zero_all_adjoints();
     }
+
+    // orders derivatives by equation (i.e. if there are 2 eqns
+    // (y1, y2) and 2 initial conditions (y0_a, y0_b), dy_dt will be
+    // ordered as: dy1_dt, dy2_dt, dy1_d{y0_a}, dy2_d{y0_a}, dy1_d{y0_b},
+    // dy2_d{y0_b})
+    Eigen::Map<const Eigen::MatrixXd> sens(z.data() + N_, N_, N_);
+    Eigen::Map<Eigen::MatrixXd> dsens_dt(dz_dt.data() + N_, N_, N_);
+    dsens_dt.noalias() = jacobian_y * sens;
   }
 
   /**
@@ -429,6 +445,11 @@ struct coupled_ode_system<F, var, var> {
    *
    * This method uses nested autodiff and is not thread safe.
    *
+   * The Jacobian of the base ODE RHS is computed with one nested
+   * reverse sweep per state. The sensitivity RHS is then formed as a
+   * single dense product of this Jacobian with the matrix of current
+   * sensitivities.
+   *
    * @param[in] z state of the coupled ode system; this must be size
    *   <code>size()</code>
    * @param[out] dz_dt a vector of size <code>size()</code> with the
@@ -451,31 +472,18 @@ struct coupled_ode_system<F, var, var> {
     check_size_match("coupled_ode_system", "dz_dt", dy_dt_vars.size(), "states",
                      N_);
 
+    Eigen::MatrixXd jacobian_y(N_, N_);
+    Eigen::MatrixXd jacobian_theta(N_, M_);
+
     for (size_t i = 0; i < N_; i++) {
       dz_dt[i] = dy_dt_vars[i].val();
       dy_dt_vars[i].grad();
 
-      for (size_t j = 0; j < N_; j++) {
-        // orders derivatives by equation (i.e. if there are 2 eqns
-        // (y1, y2) and 2 parameters (a, b), dy_dt will be ordered as:
-        // dy1_dt, dy2_dt, dy1_da, dy2_da, dy1_db, dy2_db
-        double temp_deriv = 0;
-        const size_t offset = N_ + N_ * j;
-        for (size_t k = 0; k < N_; k++) {
-          temp_deriv += z[offset + k] * y_vars[k].adj();
-        }
-
-        dz_dt[offset + i] = temp_deriv;
+      for (size_t k = 0; k < N_; k++) {
+        jacobian_y.coeffRef(i, k) = y_vars[k].adj();
       }
-
       for (size_t j = 0; j < M_; j++) {
-        double temp_deriv = theta_nochain_[j].adj();
-        const size_t offset = N_ + N_ * N_ + N_ * j;
-        for (size_t k = 0; k < N_; k++) {
-          temp_deriv += z[offset + k] * y_vars[k].adj();
-        }
-
-        dz_dt[offset + i] = temp_deriv;
+        jacobian_theta.coeffRef(i, j) = theta_nochain_[j].adj();
       }
 
       nested.set_zero_all_adjoints();
@@ -487,6 +495,15 @@ struct coupled_ode_system<F, var, var> {
         theta_nochain_[j].vi_->set_zero_adjoint();
       }
     }
+
+    // orders derivatives by equation (i.e. if there are 2 eqns
+    // (y1, y2) and 2 parameters (a, b), dy_dt will be ordered as:
+    // dy1_dt, dy2_dt, dy1_d{y0_1}, dy2_d{y0_1}, dy1_d{y0_2}, dy2_d{y0_2},
+    // dy1_da, dy2_da, dy1_db, dy2_db)
+    Eigen::Map<const Eigen::MatrixXd> sens(z.data() + N_, N_, N_ + M_);
+    Eigen::Map<Eigen::MatrixXd> dsens_dt(dz_dt.data() + N_, N_, N_ + M_);
+    dsens_dt.noalias() = jacobian_y * sens;
+    dsens_dt.rightCols(M_) += jacobian_theta;
   }
 
   /**
@@ -5,6 +5,7 @@
 #include <stan/math/rev/functor/coupled_ode_system.hpp>
 #include <stan/math/rev/functor/cvodes_utils.hpp>
 #include <stan/math/rev/functor/cvodes_ode_data.hpp>
+#include <stan/math/rev/functor/cvodes_workspace.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/functor/coupled_ode_observer.hpp>
@@ -78,6 +79,44 @@ class cvodes_integrator {
             std::ostream* msgs, double relative_tolerance,
             double absolute_tolerance,
             long int max_num_steps) {  // NOLINT(runtime/int)
+    const int max_bandwidth = static_cast<int>(y0.size()) - 1;
+    return integrate(f, y0, t0, ts, theta, x, x_int, msgs, relative_tolerance,
+                     absolute_tolerance, max_num_steps, max_bandwidth,
+                     max_bandwidth);
+  }
+
+  /**
+   * Return the solutions for the specified system of ordinary
+   * differential equations whose Jacobian wrt to the states is banded.
+   * Entry (i, j) of the Jacobian may only be non-zero for
+   * <code>i - lower_bandwidth <= j <= i + upper_bandwidth</code>. The
+   * band is stored and factorized with the band LU solver and each
+   * Jacobian takes <code>lower_bandwidth + upper_bandwidth + 1</code>
+   * reverse sweeps instead of one per state. These sweeps sum the rows
+   * which are <code>lower_bandwidth + upper_bandwidth + 1</code> apart,
+   * so derivatives outside of the band are not dropped but added to
+   * entries of other rows. If the bandwidths are understated, the
+   * Newton iteration uses a wrong Jacobian and may need more steps or
+   * fail to converge.
+   *
+   * See the overload above for the remaining arguments.
+   *
+   * @param[in] lower_bandwidth lower bandwidth of the Jacobian.
+   * @param[in] upper_bandwidth upper bandwidth of the Jacobian.
+   * @return a vector of states, each state being a vector of the
+   * same size as the state variable, corresponding to a time in ts.
+   * @throw std::domain_error if a bandwidth is negative.
+   */
+  template <typename F, typename T_initial, typename T_param, typename T_t0,
+            typename T_ts>
+  std::vector<std::vector<return_type_t<T_initial, T_param, T_t0, T_ts>>>
+  integrate(const F& f, const std::vector<T_initial>& y0, const T_t0& t0,
+            const std::vector<T_ts>& ts, const std::vector<T_param>& theta,
+            const std::vector<double>& x, const std::vector<int>& x_int,
+            std::ostream* msgs, double relative_tolerance,
+            double absolute_tolerance,
+            long int max_num_steps,  // NOLINT(runtime/int)
+            int lower_bandwidth, int upper_bandwidth) {
     using initial_var = stan::is_var<T_initial>;
     using param_var = stan::is_var<T_param>;
 
@@ -108,82 +147,46 @@ class cvodes_integrator {
                        "", ", must be greater than 0");
     }
 
+    check_nonnegative(fun, "lower_bandwidth", lower_bandwidth);
+    check_nonnegative(fun, "upper_bandwidth", upper_bandwidth);
+
     const size_t N = y0.size();
     const size_t M = theta.size();
     const size_t S = (initial_var::value ? N : 0) + (param_var::value ? M : 0);
+    const size_t ml = std::min(N - 1, static_cast<size_t>(lower_bandwidth));
+    const size_t mu = std::min(N - 1, static_cast<size_t>(upper_bandwidth));
 
     using ode_data = cvodes_ode_data<F, T_initial, T_param>;
     ode_data cvodes_data(f, y0, theta, x, x_int, msgs);
 
-    void* cvodes_mem = CVodeCreate(Lmm);
-    if (cvodes_mem == nullptr) {
-      throw std::runtime_error("CVodeCreate failed to allocate memory");
-    }
-
-    const size_t coupled_size = cvodes_data.coupled_ode_.size();
-
     std::vector<std::vector<return_type_t<T_initial, T_param, T_t0, T_ts>>> y;
     coupled_ode_observer<F, T_initial, T_param, T_t0, T_ts> observer(
         f, y0, theta, t0, ts, x, x_int, msgs, y);
 
-    try {
-      check_flag_sundials(CVodeInit(cvodes_mem, &ode_data::cv_rhs, t0_dbl,
-                                    cvodes_data.nv_state_),
-                          "CVodeInit");
-
-      // Assign pointer to this as user data
-      check_flag_sundials(
-          CVodeSetUserData(cvodes_mem, reinterpret_cast<void*>(&cvodes_data)),
-          "CVodeSetUserData");
-
-      cvodes_set_options(cvodes_mem, relative_tolerance, absolute_tolerance,
-                         max_num_steps);
-
-      // for the stiff solvers we need to reserve additional memory
-      // and provide a Jacobian function call. new API since 3.0.0:
-      // create matrix object and linear solver object; resource
-      // (de-)allocation is handled in the cvodes_ode_data
-      check_flag_sundials(
-          CVodeSetLinearSolver(cvodes_mem, cvodes_data.LS_, cvodes_data.A_),
-          "CVodeSetLinearSolver");
-      check_flag_sundials(
-          CVodeSetJacFn(cvodes_mem, &ode_data::cv_jacobian_states),
-          "CVodeSetJacFn");
-
-      // initialize forward sensitivity system of CVODES as needed
+    // the CVODES resources are reused across solves of ODEs of the
+    // same type and size
+    const auto workspace = cvodes_workspace<Lmm, ode_data>::get(N, S, ml, mu);
+    workspace->reinit(cvodes_data, t0_dbl, relative_tolerance,
+                      absolute_tolerance, max_num_steps);
+    void* cvodes_mem = workspace->cvodes_mem_;
+
+    double t_init = t0_dbl;
+    for (size_t n = 0; n < ts.size(); ++n) {
+      double t_final = ts_dbl[n];
+      if (t_final != t_init) {
+        check_flag_sundials(CVode(cvodes_mem, t_final, workspace->nv_state_,
+                                  &t_init, CV_NORMAL),
+                            "CVode");
+      }
       if (S > 0) {
         check_flag_sundials(
-            CVodeSensInit(cvodes_mem, static_cast<int>(S), CV_STAGGERED,
-                          &ode_data::cv_rhs_sens, cvodes_data.nv_state_sens_),
-            "CVodeSensInit");
-
-        check_flag_sundials(CVodeSensEEtolerances(cvodes_mem),
-                            "CVodeSensEEtolerances");
+            CVodeGetSens(cvodes_mem, &t_init, workspace->nv_state_sens_),
+            "CVodeGetSens");
       }
-
-      double t_init = t0_dbl;
-      for (size_t n = 0; n < ts.size(); ++n) {
-        double t_final = ts_dbl[n];
-        if (t_final != t_init) {
-          check_flag_sundials(CVode(cvodes_mem, t_final, cvodes_data.nv_state_,
-                                    &t_init, CV_NORMAL),
-                              "CVode");
-        }
-        if (S > 0) {
-          check_flag_sundials(
-              CVodeGetSens(cvodes_mem, &t_init, cvodes_data.nv_state_sens_),
-              "CVodeGetSens");
-        }
-        observer(cvodes_data.coupled_state_, t_final);
-        t_init = t_final;
-      }
-    } catch (const std::exception& e) {
-      CVodeFree(&cvodes_mem);
-      throw;
+      observer(cvodes_data.coupled_state_, t_final);
+      t_init = t_final;
     }
 
-    CVodeFree(&cvodes_mem);
-
     return y;
   }
 };  // cvodes integrator
@@ -0,0 +1,442 @@
+#ifndef STAN_MATH_REV_FUNCTOR_CVODES_ODE_ADJOINT_DATA_HPP
+#define STAN_MATH_REV_FUNCTOR_CVODES_ODE_ADJOINT_DATA_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/dot_product.hpp>
+#include <stan/math/rev/functor/coupled_ode_system.hpp>
+#include <stan/math/rev/functor/cvodes_utils.hpp>
+#include <stan/math/prim/err.hpp>
+#include <cvodes/cvodes.h>
+#include <sunmatrix/sunmatrix_dense.h>
+#include <sunlinsol/sunlinsol_dense.h>
+#include <nvector/nvector_serial.h>
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * CVODES ode data holder object for the adjoint sensitivity method.
+ *
+ * The object owns the CVODES memory of the forward problem including
+ * its checkpoints, the memory of the backward (adjoint) problem and
+ * copies of the ODE functor and data. As the backward problem is only
+ * solved during the reverse sweep, the object is a
+ * <code>chainable_alloc</code> which is destructed (and all CVODES
+ * resources freed) whenever the autodiff memory is recovered.
+ *
+ * The adjoint state \f$\lambda\f$ and the quadrature state \f$q\f$
+ * follow
+ * \f[
+ *   \frac{d\lambda}{dt} = - \left(\frac{\partial f}{\partial y}\right)^T
+ *   \lambda, \qquad
+ *   \frac{dq}{dt} = - \left(\frac{\partial f}{\partial \theta}\right)^T
+ *   \lambda,
+ * \f]
+ * which are integrated backwards in time. Both right hand sides are
+ * vector-Jacobian products computed with a single nested reverse
+ * sweep each.
+ *
+ * @tparam F type of functor for the base ode system.
+ */
+template <typename F>
+class cvodes_ode_adjoint_data : public chainable_alloc {
+  using ode_data = cvodes_ode_adjoint_data<F>;
+
+ public:
+  const F f_;
+  const size_t N_;
+  const size_t M_;
+  const std::vector<double> theta_dbl_;
+  const std::vector<double> x_;
+  const std::vector<int> x_int_;
+  std::ostream* msgs_;
+  const bool with_quadrature_;
+  std::vector<double> state_;
+  std::vector<double> state_adj_;
+  std::vector<double> quad_;
+  N_Vector nv_state_;
+  N_Vector nv_state_adj_;
+  N_Vector nv_quad_;
+  SUNMatrix A_;
+  SUNLinearSolver LS_;
+  SUNMatrix A_adj_;
+  SUNLinearSolver LS_adj_;
+  void* cvodes_mem_;
+  int index_adj_;
+  bool adj_initialized_;
+  double relative_tolerance_;
+  double absolute_tolerance_;
+  long int max_num_steps_;  // NOLINT(runtime/int)
+
+  /**
+   * Construct the CVODES adjoint data object. The CVODES memory is
+   * allocated, but not yet initialized.
+   *
+   * @param[in] f ode functor.
+   * @param[in] y0 initial state of the base ode.
+   * @param[in] theta parameters of the base ode.
+   * @param[in] x continuous data vector for the ODE.
+   * @param[in] x_int integer data vector for the ODE.
+   * @param[in] msgs stream to which messages are printed.
+   * @param[in] with_quadrature whether the gradient wrt to the
+   * parameters is integrated as quadrature along the backward solve.
+   * @throw std::runtime_error if CVODES fails to allocate memory.
+   */
+  cvodes_ode_adjoint_data(const F& f, const std::vector<double>& y0,
+                          const std::vector<double>& theta,
+                          const std::vector<double>& x,
+                          const std::vector<int>& x_int, std::ostream* msgs,
+                          bool with_quadrature)
+      : f_(f),
+        N_(y0.size()),
+        M_(theta.size()),
+        theta_dbl_(theta),
+        x_(x),
+        x_int_(x_int),
+        msgs_(msgs),
+        with_quadrature_(with_quadrature && M_ > 0),
+        state_(y0),
+        state_adj_(N_, 0.0),
+        quad_(with_quadrature_ ? M_ : 0, 0.0),
+        nv_state_(N_VMake_Serial(N_, &state_[0])),
+        nv_state_adj_(N_VMake_Serial(N_, &state_adj_[0])),
+        nv_quad_(with_quadrature_ ? N_VMake_Serial(M_, &quad_[0])
+                                  : nullptr),
+        A_(SUNDenseMatrix(N_, N_)),
+        LS_(SUNDenseLinearSolver(nv_state_, A_)),
+        A_adj_(SUNDenseMatrix(N_, N_)),
+        LS_adj_(SUNDenseLinearSolver(nv_state_adj_, A_adj_)),
+        cvodes_mem_(CVodeCreate(CV_BDF)),
+        index_adj_(-1),
+        adj_initialized_(false),
+        relative_tolerance_(0),
+        absolute_tolerance_(0),
+        max_num_steps_(0) {
+    if (cvodes_mem_ == nullptr) {
+      throw std::runtime_error("CVodeCreate failed to allocate memory");
+    }
+  }
+
+  ~cvodes_ode_adjoint_data() {
+    CVodeFree(&cvodes_mem_);
+    SUNLinSolFree(LS_adj_);
+    SUNMatDestroy(A_adj_);
+    SUNLinSolFree(LS_);
+    SUNMatDestroy(A_);
+    if (with_quadrature_) {
+      N_VDestroy_Serial(nv_quad_);
+    }
+    N_VDestroy_Serial(nv_state_adj_);
+    N_VDestroy_Serial(nv_state_);
+  }
+
+  /**
+   * Implements the function of type CVRhsFn which is the user-defined
+   * ODE RHS passed to CVODES.
+   */
+  static int cv_rhs(realtype t, N_Vector y, N_Vector ydot, void* user_data) {
+    const ode_data* explicit_ode = static_cast<const ode_data*>(user_data);
+    explicit_ode->rhs(t, NV_DATA_S(y), NV_DATA_S(ydot));
+    return 0;
+  }
+
+  /**
+   * Implements the function of type CVDlsJacFn which is the
+   * user-defined callback for CVODES to calculate the jacobian of the
+   * ode_rhs wrt to the states y. The jacobian is stored in column
+   * major format.
+   */
+  static int cv_jacobian_states(realtype t, N_Vector y, N_Vector fy,
+                                SUNMatrix J, void* user_data, N_Vector tmp1,
+                                N_Vector tmp2, N_Vector tmp3) {
+    const ode_data* explicit_ode = static_cast<const ode_data*>(user_data);
+    explicit_ode->jacobian_states(t, NV_DATA_S(y), SM_DATA_D(J));
+    return 0;
+  }
+
+  /**
+   * Implements the function of type CVRhsFnB which is the RHS of the
+   * adjoint ODE system.
+   */
+  static int cv_rhs_adj(realtype t, N_Vector y, N_Vector yB, N_Vector yBdot,
+                        void* user_data) {
+    const ode_data* explicit_ode = static_cast<const ode_data*>(user_data);
+    explicit_ode->rhs_adj(t, NV_DATA_S(y), NV_DATA_S(yB), NV_DATA_S(yBdot));
+    return 0;
+  }
+
+  /**
+   * Implements the function of type CVQuadRhsFnB which is the RHS of
+   * the quadrature of the backward problem giving the gradient wrt to
+   * the parameters.
+   */
+  static int cv_quad_rhs_adj(realtype t, N_Vector y, N_Vector yB,
+                             N_Vector qBdot, void* user_data) {
+    const ode_data* explicit_ode = static_cast<const ode_data*>(user_data);
+    explicit_ode->quad_rhs_adj(t, NV_DATA_S(y), NV_DATA_S(yB),
+                               NV_DATA_S(qBdot));
+    return 0;
+  }
+
+  /**
+   * Implements the function of type CVLsJacFnB which is the Jacobian
+   * of the adjoint ODE RHS wrt to the adjoint states. This is the
+   * negative transpose of the Jacobian of the ODE RHS wrt to the
+   * states.
+   */
+  static int cv_jacobian_adj(realtype t, N_Vector y, N_Vector yB,
+                             N_Vector fyB, SUNMatrix J, void* user_data,
+                             N_Vector tmp1, N_Vector tmp2, N_Vector tmp3) {
+    const ode_data* explicit_ode = static_cast<const ode_data*>(user_data);
+    explicit_ode->jacobian_adj(t, NV_DATA_S(y), SM_DATA_D(J));
+    return 0;
+  }
+
+  /**
+   * Evaluates the ODE RHS for double states and parameters.
+   *
+   * @param[in] t time
+   * @param[in] y state of the base ODE
+   * @param[out] dy_dt RHS of the base ODE
+   */
+  inline void rhs(double t, const double y[], double dy_dt[]) const {
+    const std::vector<double> y_vec(y, y + N_);
+    const std::vector<double>& dy_dt_vec
+        = f_(t, y_vec, theta_dbl_, x_, x_int_, msgs_);
+    check_size_match("cvodes_ode_adjoint_data", "dz_dt", dy_dt_vec.size(),
+                     "states", N_);
+    std::copy(dy_dt_vec.begin(), dy_dt_vec.end(), dy_dt);
+  }
+
+  /**
+   * Solve the forward problem and record checkpoints for the backward
+   * solve. CVODES stores a checkpoint every
+   * <code>num_steps_between_checkpoints</code> integration steps and
+   * recomputes the forward solution between checkpoints during the
+   * backward solve, such that fewer checkpoints trade memory for
+   * additional computation.
+   *
+   * @param[in] t0 initial time.
+   * @param[in] ts times of the desired solutions, in strictly
+   * increasing order, all greater than the initial time.
+   * @param[in] relative_tolerance relative tolerance passed to CVODE.
+   * @param[in] absolute_tolerance absolute tolerance passed to CVODE.
+   * @param[in] max_num_steps maximal number of admissable steps
+   * between time-points
+   * @param[in] num_steps_between_checkpoints number of integration
+   * steps between checkpoints of the forward solution.
+   * @param[in] interpolation_polynomial type of interpolation of the
+   * forward solution between checkpoints (CV_HERMITE or
+   * CV_POLYNOMIAL).
+   * @return a vector of states, each state being a vector of the
+   * same size as the state variable, corresponding to a time in ts.
+   */
+  std::vector<std::vector<double>> integrate_forward(
+      double t0, const std::vector<double>& ts, double relative_tolerance,
+      double absolute_tolerance,
+      long int max_num_steps,                 // NOLINT(runtime/int)
+      long int num_steps_between_checkpoints,  // NOLINT(runtime/int)
+      int interpolation_polynomial) {
+    relative_tolerance_ = relative_tolerance;
+    absolute_tolerance_ = absolute_tolerance;
+    max_num_steps_ = max_num_steps;
+
+    check_flag_sundials(
+        CVodeInit(cvodes_mem_, &ode_data::cv_rhs, t0, nv_state_), "CVodeInit");
+    check_flag_sundials(
+        CVodeSetUserData(cvodes_mem_, reinterpret_cast<void*>(this)),
+        "CVodeSetUserData");
+    cvodes_set_options(cvodes_mem_, relative_tolerance, absolute_tolerance,
+                       max_num_steps);
+    check_flag_sundials(CVodeSetLinearSolver(cvodes_mem_, LS_, A_),
+                        "CVodeSetLinearSolver");
+    check_flag_sundials(
+        CVodeSetJacFn(cvodes_mem_, &ode_data::cv_jacobian_states),
+        "CVodeSetJacFn");
+    check_flag_sundials(CVodeAdjInit(cvodes_mem_, num_steps_between_checkpoints,
+                                     interpolation_polynomial),
+                        "CVodeAdjInit");
+
+    std::vector<std::vector<double>> y;
+    y.reserve(ts.size());
+    double t_init = t0;
+    for (size_t n = 0; n < ts.size(); ++n) {
+      // CVodeF does not honor the maximal number of steps in normal
+      // mode, hence the steps between output times are taken one by
+      // one and the solution is interpolated at the output time.
+      long int num_steps = 0;  // NOLINT(runtime/int)
+      while (t_init < ts[n]) {
+        if (++num_steps > max_num_steps) {
+          check_flag_sundials(CV_TOO_MUCH_WORK, "CVodeF");
+        }
+        int num_checkpoints = 0;
+        check_flag_sundials(CVodeF(cvodes_mem_, ts[n], nv_state_, &t_init,
+                                   CV_ONE_STEP, &num_checkpoints),
+                            "CVodeF");
+      }
+      check_flag_sundials(CVodeGetDky(cvodes_mem_, ts[n], 0, nv_state_),
+                          "CVodeGetDky");
+      y.emplace_back(state_);
+    }
+    return y;
+  }
+
+  /**
+   * Solve the backward problem from <code>t_init</code> to
+   * <code>t_final < t_init</code> starting at the adjoint state
+   * currently held in <code>state_adj_</code> and the quadrature held
+   * in <code>quad_</code>. On return both hold the respective states
+   * at <code>t_final</code>.
+   *
+   * The backward problem is created on first use and re-initialized
+   * on subsequent calls such that adjoint jumps at intermediate output
+   * times can be applied in between.
+   *
+   * @param[in] t_init time at which the backward solve starts.
+   * @param[in] t_final time at which the backward solve ends.
+   */
+  void integrate_backward(double t_init, double t_final) {
+    if (!adj_initialized_) {
+      check_flag_sundials(CVodeCreateB(cvodes_mem_, CV_BDF, &index_adj_),
+                          "CVodeCreateB");
+      check_flag_sundials(CVodeInitB(cvodes_mem_, index_adj_,
+                                     &ode_data::cv_rhs_adj, t_init,
+                                     nv_state_adj_),
+                          "CVodeInitB");
+      check_flag_sundials(
+          CVodeSStolerancesB(cvodes_mem_, index_adj_, relative_tolerance_,
+                             absolute_tolerance_),
+          "CVodeSStolerancesB");
+      check_flag_sundials(
+          CVodeSetUserDataB(cvodes_mem_, index_adj_,
+                            reinterpret_cast<void*>(this)),
+          "CVodeSetUserDataB");
+      check_flag_sundials(
+          CVodeSetMaxNumStepsB(cvodes_mem_, index_adj_, max_num_steps_),
+          "CVodeSetMaxNumStepsB");
+      check_flag_sundials(
+          CVodeSetLinearSolverB(cvodes_mem_, index_adj_, LS_adj_, A_adj_),
+          "CVodeSetLinearSolverB");
+      check_flag_sundials(
+          CVodeSetJacFnB(cvodes_mem_, index_adj_, &ode_data::cv_jacobian_adj),
+          "CVodeSetJacFnB");
+      if (with_quadrature_) {
+        check_flag_sundials(CVodeQuadInitB(cvodes_mem_, index_adj_,
+                                           &ode_data::cv_quad_rhs_adj,
+                                           nv_quad_),
+                            "CVodeQuadInitB");
+        check_flag_sundials(
+            CVodeQuadSStolerancesB(cvodes_mem_, index_adj_,
+                                   relative_tolerance_, absolute_tolerance_),
+            "CVodeQuadSStolerancesB");
+        check_flag_sundials(
+            CVodeSetQuadErrConB(cvodes_mem_, index_adj_, SUNTRUE),
+            "CVodeSetQuadErrConB");
+      }
+      adj_initialized_ = true;
+    } else {
+      check_flag_sundials(
+          CVodeReInitB(cvodes_mem_, index_adj_, t_init, nv_state_adj_),
+          "CVodeReInitB");
+      if (with_quadrature_) {
+        check_flag_sundials(
+            CVodeQuadReInitB(cvodes_mem_, index_adj_, nv_quad_),
+            "CVodeQuadReInitB");
+      }
+    }
+
+    check_flag_sundials(CVodeB(cvodes_mem_, t_final, CV_NORMAL), "CVodeB");
+
+    double t_ret = t_final;
+    check_flag_sundials(
+        CVodeGetB(cvodes_mem_, index_adj_, &t_ret, nv_state_adj_),
+        "CVodeGetB");
+    if (with_quadrature_) {
+      check_flag_sundials(
+          CVodeGetQuadB(cvodes_mem_, index_adj_, &t_ret, nv_quad_),
+          "CVodeGetQuadB");
+    }
+  }
+
+ private:
+  /**
+   * Calculates the jacobian of the ODE RHS wrt to its states y at the
+   * given time-point t and state y in column major format.
+   */
+  inline void jacobian_states(double t, const double y[], double J[]) const {
+    nested_rev_autodiff nested;
+
+    const std::vector<var> y_vec_var(y, y + N_);
+    coupled_ode_system<F, var, double> ode_jacobian(f_, y_vec_var, theta_dbl_,
+                                                    x_, x_int_, msgs_);
+    std::vector<double> jacobian_y(ode_jacobian.size());
+    ode_jacobian(ode_jacobian.initial_state(), jacobian_y, t);
+    std::copy(jacobian_y.begin() + N_, jacobian_y.end(), J);
+  }
+
+  /**
+   * Calculates the negative transpose of the jacobian of the ODE RHS
+   * wrt to its states y in column major format.
+   */
+  inline void jacobian_adj(double t, const double y[], double J[]) const {
+    jacobian_states(t, y, J);
+    Eigen::Map<Eigen::MatrixXd> J_map(J, N_, N_);
+    J_map.transposeInPlace();
+    J_map *= -1.0;
+  }
+
+  /**
+   * Calculates the adjoint ODE RHS, -J_y^T * y_adj, using a single
+   * nested reverse sweep.
+   */
+  inline void rhs_adj(double t, const double y[], const double y_adj[],
+                      double y_adj_dot[]) const {
+    nested_rev_autodiff nested;
+
+    const std::vector<var> y_vars(y, y + N_);
+    const std::vector<var> dy_dt_vars
+        = f_(t, y_vars, theta_dbl_, x_, x_int_, msgs_);
+    check_size_match("cvodes_ode_adjoint_data", "dz_dt", dy_dt_vars.size(),
+                     "states", N_);
+
+    var y_adj_dot_f
+        = dot_product(dy_dt_vars, std::vector<double>(y_adj, y_adj + N_));
+    y_adj_dot_f.grad();
+
+    for (size_t i = 0; i < N_; ++i) {
+      y_adj_dot[i] = -y_vars[i].adj();
+    }
+  }
+
+  /**
+   * Calculates the quadrature RHS, -J_theta^T * y_adj, using a single
+   * nested reverse sweep.
+   */
+  inline void quad_rhs_adj(double t, const double y[], const double y_adj[],
+                           double quad_dot[]) const {
+    nested_rev_autodiff nested;
+
+    const std::vector<var> y_vars(y, y + N_);
+    const std::vector<var> theta_vars(theta_dbl_.begin(), theta_dbl_.end());
+    const std::vector<var> dy_dt_vars
+        = f_(t, y_vars, theta_vars, x_, x_int_, msgs_);
+    check_size_match("cvodes_ode_adjoint_data", "dz_dt", dy_dt_vars.size(),
+                     "states", N_);
+
+    var y_adj_dot_f
+        = dot_product(dy_dt_vars, std::vector<double>(y_adj, y_adj + N_));
+    y_adj_dot_f.grad();
+
+    for (size_t j = 0; j < M_; ++j) {
+      quad_dot[j] = -theta_vars[j].adj();
+    }
+  }
+};
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -5,8 +5,8 @@
 #include <stan/math/rev/functor/coupled_ode_system.hpp>
 #include <stan/math/prim/functor/coupled_ode_system.hpp>
 #include <cvodes/cvodes.h>
+#include <sunmatrix/sunmatrix_band.h>
 #include <sunmatrix/sunmatrix_dense.h>
-#include <sunlinsol/sunlinsol_dense.h>
 #include <nvector/nvector_serial.h>
 #include <algorithm>
 #include <vector>
@@ -16,7 +16,9 @@ namespace math {
 
 /**
  * CVODES ode data holder object which is used during CVODES
- * integration for CVODES callbacks.
+ * integration for CVODES callbacks. The CVODES resources are held by
+ * a cvodes_workspace, which integrates the coupled state of this
+ * object.
  *
  * @tparam F type of functor for the base ode system.
  * @tparam T_initial type of initial values
@@ -42,10 +44,6 @@ class cvodes_ode_data {
  public:
   const coupled_ode_system<F, T_initial, T_param> coupled_ode_;
   std::vector<double> coupled_state_;
-  N_Vector nv_state_;
-  N_Vector* nv_state_sens_;
-  SUNMatrix A_;
-  SUNLinearSolver LS_;
 
   /**
    * Construct CVODES ode data object to enable callbacks from
@@ -84,27 +82,7 @@ class cvodes_ode_data {
         msgs_(msgs),
         S_((initial_var::value ? N_ : 0) + (param_var::value ? M_ : 0)),
         coupled_ode_(f, y0, theta, x, x_int, msgs),
-        coupled_state_(coupled_ode_.initial_state()),
-        nv_state_(N_VMake_Serial(N_, &coupled_state_[0])),
-        nv_state_sens_(nullptr),
-        A_(SUNDenseMatrix(N_, N_)),
-        LS_(SUNDenseLinearSolver(nv_state_, A_)) {
-    if (S_ > 0) {
-      nv_state_sens_ = N_VCloneVectorArrayEmpty_Serial(S_, nv_state_);
-      for (std::size_t i = 0; i < S_; i++) {
-        NV_DATA_S(nv_state_sens_[i]) = &coupled_state_[N_] + i * N_;
-      }
-    }
-  }
-
-  ~cvodes_ode_data() {
-    SUNLinSolFree(LS_);
-    SUNMatDestroy(A_);
-    N_VDestroy_Serial(nv_state_);
-    if (S_ > 0) {
-      N_VDestroyVectorArray_Serial(nv_state_sens_, S_);
-    }
-  }
+        coupled_state_(coupled_ode_.initial_state()) {}
 
   /**
    * Implements the function of type CVRhsFn which is the user-defined
@@ -161,8 +139,15 @@ class cvodes_ode_data {
    * Note that the jacobian of the ODE system is the coupled ode system for
    * varying states evaluated at the state y whenever we choose state
    * y to be the initial of the coupled ode system.
+   *
+   * A banded jacobian is calculated with
+   * <code>jacobian_states_banded</code> instead.
    */
   inline int jacobian_states(double t, const double y[], SUNMatrix J) const {
+    if (SUNMatGetID(J) == SUNMATRIX_BAND) {
+      return jacobian_states_banded(t, y, J);
+    }
+
     // Run nested autodiff in this scope
     nested_rev_autodiff nested;
 
@@ -175,6 +160,56 @@ class cvodes_ode_data {
     return 0;
   }
 
+  /**
+   * Calculates the banded jacobian of the ODE RHS wrt to its states y
+   * at the given time-point t and state y.
+   *
+   * Two rows of a jacobian with lower bandwidth ml and upper bandwidth
+   * mu which are at least ml + mu + 1 rows apart depend on disjoint
+   * sets of states. The rows are therefore grouped by their index
+   * modulo ml + mu + 1 and each group is calculated with a single
+   * reverse sweep of the sum of its rows, which takes ml + mu + 1
+   * sweeps instead of N.
+   *
+   * This relies on the Jacobian being zero outside of the band. A
+   * derivative outside of the band of one row is added to the entry in
+   * the same column of another row of its group, so with understated
+   * bandwidths the Jacobian is wrong. CVODES only uses it in the Newton
+   * iteration, which then converges more slowly or not at all, but the
+   * accepted solution is still controlled by the error test.
+   */
+  inline int jacobian_states_banded(double t, const double y[],
+                                    SUNMatrix J) const {
+    const size_t ml = SM_LBAND_B(J);
+    const size_t mu = SM_UBAND_B(J);
+    const size_t num_groups = std::min(N_, ml + mu + 1);
+
+    // Run nested autodiff in this scope
+    nested_rev_autodiff nested;
+
+    const std::vector<var> y_vars(y, y + N_);
+    const std::vector<var> dy_dt_vars
+        = f_(t, y_vars, theta_dbl_, x_, x_int_, msgs_);
+    check_size_match("cvodes_ode_data", "dz_dt", dy_dt_vars.size(), "states",
+                     N_);
+
+    for (size_t g = 0; g < num_groups; ++g) {
+      var group_sum = 0;
+      for (size_t i = g; i < N_; i += num_groups) {
+        group_sum += dy_dt_vars[i];
+      }
+      group_sum.grad();
+      for (size_t i = g; i < N_; i += num_groups) {
+        const size_t j_end = std::min(N_, i + mu + 1);
+        for (size_t j = i < ml ? 0 : i - ml; j < j_end; ++j) {
+          SM_ELEMENT_B(J, i, j) = y_vars[j].adj();
+        }
+      }
+      nested.set_zero_all_adjoints();
+    }
+    return 0;
+  }
+
   /**
    * Calculates the RHS of the sensitivity ODE system which
    * corresponds to the coupled ode system from which the first N
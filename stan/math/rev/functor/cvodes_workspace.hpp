@@ -0,0 +1,263 @@
+#ifndef STAN_MATH_REV_FUNCTOR_CVODES_WORKSPACE_HPP
+#define STAN_MATH_REV_FUNCTOR_CVODES_WORKSPACE_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/functor/cvodes_utils.hpp>
+#include <stan/math/prim/err.hpp>
+#include <cvodes/cvodes.h>
+#include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_dense.h>
+#include <sunlinsol/sunlinsol_band.h>
+#include <sunlinsol/sunlinsol_dense.h>
+#include <nvector/nvector_serial.h>
+#include <memory>
+#include <stdexcept>
+
+namespace stan {
+namespace math {
+
+/**
+ * CVODES solver memory together with the state vectors, the Jacobian
+ * matrix and the linear solver for an ODE system of a given size. The
+ * workspace is created once and reinitialized for each solve, which
+ * avoids to allocate and free all CVODES resources for repeated solves
+ * of ODEs of the same type and size.
+ *
+ * The Jacobian of an ODE system whose Jacobian wrt to the states is
+ * banded with a lower bandwidth smaller than N - 1 or an upper
+ * bandwidth smaller than N - 1 is stored as a band matrix and
+ * factorized with the band LU solver of SUNDIALS. Otherwise the dense
+ * solver is used.
+ *
+ * The state vectors do not own their data, but are pointed to the
+ * coupled state of the ode data of the current solve. CVODES keeps the
+ * user data it was given when the sensitivities got initialized, hence
+ * the workspace itself is registered as user data and forwards all
+ * callbacks to the ode data of the current solve.
+ *
+ * @tparam Lmm ID of ODE solver (1: ADAMS, 2: BDF)
+ * @tparam ode_data type of the CVODES ode data holder which provides
+ * the callbacks of the ODE system
+ */
+template <int Lmm, typename ode_data>
+class cvodes_workspace {
+  bool initialized_;
+  ode_data* cvodes_data_;
+
+ public:
+  const size_t N_;
+  const size_t S_;
+  const size_t lower_bandwidth_;
+  const size_t upper_bandwidth_;
+  void* cvodes_mem_;
+  N_Vector nv_state_;
+  N_Vector* nv_state_sens_;
+  SUNMatrix A_;
+  SUNLinearSolver LS_;
+
+  /**
+   * Construct a CVODES workspace for an ODE system.
+   *
+   * @param[in] N number of states of the base ODE.
+   * @param[in] S number of sensitivities.
+   * @param[in] lower_bandwidth lower bandwidth of the Jacobian, at most
+   * N - 1.
+   * @param[in] upper_bandwidth upper bandwidth of the Jacobian, at most
+   * N - 1.
+   * @throw std::runtime_error if CVODES fails to allocate memory.
+   */
+  cvodes_workspace(size_t N, size_t S, size_t lower_bandwidth,
+                   size_t upper_bandwidth)
+      : initialized_(false),
+        cvodes_data_(nullptr),
+        N_(N),
+        S_(S),
+        lower_bandwidth_(lower_bandwidth),
+        upper_bandwidth_(upper_bandwidth),
+        cvodes_mem_(CVodeCreate(Lmm)),
+        nv_state_(N_VNewEmpty_Serial(N)),
+        nv_state_sens_(nullptr),
+        A_(is_banded() ? SUNBandMatrix(N, upper_bandwidth, lower_bandwidth)
+                       : SUNDenseMatrix(N, N)),
+        LS_(is_banded() ? SUNLinSol_Band(nv_state_, A_)
+                        : SUNDenseLinearSolver(nv_state_, A_)) {
+    if (S_ > 0) {
+      nv_state_sens_ = N_VCloneVectorArrayEmpty_Serial(S_, nv_state_);
+    }
+    if (cvodes_mem_ == nullptr) {
+      free_resources();
+      throw std::runtime_error("CVodeCreate failed to allocate memory");
+    }
+  }
+
+  cvodes_workspace(const cvodes_workspace&) = delete;
+  cvodes_workspace& operator=(const cvodes_workspace&) = delete;
+
+  ~cvodes_workspace() { free_resources(); }
+
+  /**
+   * Return true if the Jacobian is stored as a band matrix.
+   */
+  inline bool is_banded() const {
+    return lower_bandwidth_ + 1 < N_ || upper_bandwidth_ + 1 < N_;
+  }
+
+  /**
+   * Prepare the workspace for integrating the coupled ODE system of
+   * the given ode data from time t0. The state vectors are pointed to
+   * the coupled state of the ode data. CVODES is initialized on the
+   * first solve and reinitialized on all further solves.
+   *
+   * @param[in] cvodes_data ode data of the solve.
+   * @param[in] t0 initial time.
+   * @param[in] relative_tolerance relative tolerance passed to CVODE.
+   * @param[in] absolute_tolerance absolute tolerance passed to CVODE.
+   * @param[in] max_num_steps maximal number of admissable steps
+   * between time-points
+   */
+  void reinit(ode_data& cvodes_data, double t0, double relative_tolerance,
+              double absolute_tolerance,
+              long int max_num_steps) {  // NOLINT(runtime/int)
+    cvodes_data_ = &cvodes_data;
+    N_VSetArrayPointer_Serial(&cvodes_data.coupled_state_[0], nv_state_);
+    for (std::size_t i = 0; i < S_; i++) {
+      NV_DATA_S(nv_state_sens_[i]) = &cvodes_data.coupled_state_[N_] + i * N_;
+    }
+
+    if (initialized_) {
+      check_flag_sundials(CVodeReInit(cvodes_mem_, t0, nv_state_),
+                          "CVodeReInit");
+    } else {
+      check_flag_sundials(CVodeInit(cvodes_mem_, &cv_rhs, t0, nv_state_),
+                          "CVodeInit");
+      check_flag_sundials(
+          CVodeSetUserData(cvodes_mem_, reinterpret_cast<void*>(this)),
+          "CVodeSetUserData");
+    }
+
+    cvodes_set_options(cvodes_mem_, relative_tolerance, absolute_tolerance,
+                       max_num_steps);
+
+    if (initialized_) {
+      if (S_ > 0) {
+        check_flag_sundials(
+            CVodeSensReInit(cvodes_mem_, CV_STAGGERED, nv_state_sens_),
+            "CVodeSensReInit");
+      }
+      return;
+    }
+
+    // for the stiff solvers we need to reserve additional memory
+    // and provide a Jacobian function call. new API since 3.0.0:
+    // create matrix object and linear solver object
+    check_flag_sundials(CVodeSetLinearSolver(cvodes_mem_, LS_, A_),
+                        "CVodeSetLinearSolver");
+    check_flag_sundials(CVodeSetJacFn(cvodes_mem_, &cv_jacobian_states),
+                        "CVodeSetJacFn");
+
+    // initialize forward sensitivity system of CVODES as needed
+    if (S_ > 0) {
+      check_flag_sundials(
+          CVodeSensInit(cvodes_mem_, static_cast<int>(S_), CV_STAGGERED,
+                        &cv_rhs_sens, nv_state_sens_),
+          "CVodeSensInit");
+
+      check_flag_sundials(CVodeSensEEtolerances(cvodes_mem_),
+                          "CVodeSensEEtolerances");
+    }
+
+    initialized_ = true;
+  }
+
+  /**
+   * Return the workspace for an ODE system of the given size. The
+   * workspace is cached per thread and reused as long as the sizes
+   * and bandwidths match. Should the cached workspace be in use by an
+   * enclosing solve, a new workspace is returned which is not cached.
+   *
+   * There is a single cached workspace per solver and ode data type, so
+   * a model which alternates between ODE systems of different sizes
+   * with the same functor replaces the cached workspace on every solve
+   * and gets no reuse at all.
+   *
+   * @param[in] N number of states of the base ODE.
+   * @param[in] S number of sensitivities.
+   * @param[in] lower_bandwidth lower bandwidth of the Jacobian, at most
+   * N - 1.
+   * @param[in] upper_bandwidth upper bandwidth of the Jacobian, at most
+   * N - 1.
+   * @return workspace for the ODE system
+   */
+  static std::shared_ptr<cvodes_workspace> get(size_t N, size_t S,
+                                               size_t lower_bandwidth,
+                                               size_t upper_bandwidth) {
+#ifdef STAN_THREADS
+    static thread_local std::shared_ptr<cvodes_workspace> cached;
+#else
+    static std::shared_ptr<cvodes_workspace> cached;
+#endif
+    if (cached && cached.use_count() > 1) {
+      return std::make_shared<cvodes_workspace>(N, S, lower_bandwidth,
+                                                upper_bandwidth);
+    }
+    if (!cached || cached->N_ != N || cached->S_ != S
+        || cached->lower_bandwidth_ != lower_bandwidth
+        || cached->upper_bandwidth_ != upper_bandwidth) {
+      cached.reset();
+      cached = std::make_shared<cvodes_workspace>(N, S, lower_bandwidth,
+                                                  upper_bandwidth);
+    }
+    return cached;
+  }
+
+ private:
+  /**
+   * Forwards the ODE RHS callback to the ode data of the current solve.
+   */
+  static int cv_rhs(realtype t, N_Vector y, N_Vector ydot, void* user_data) {
+    ode_data* cvodes_data
+        = static_cast<cvodes_workspace*>(user_data)->cvodes_data_;
+    return ode_data::cv_rhs(t, y, ydot, cvodes_data);
+  }
+
+  /**
+   * Forwards the sensitivity RHS callback to the ode data of the current
+   * solve.
+   */
+  static int cv_rhs_sens(int Ns, realtype t, N_Vector y, N_Vector ydot,
+                         N_Vector* yS, N_Vector* ySdot, void* user_data,
+                         N_Vector tmp1, N_Vector tmp2) {
+    ode_data* cvodes_data
+        = static_cast<cvodes_workspace*>(user_data)->cvodes_data_;
+    return ode_data::cv_rhs_sens(Ns, t, y, ydot, yS, ySdot, cvodes_data, tmp1,
+                                 tmp2);
+  }
+
+  /**
+   * Forwards the Jacobian callback to the ode data of the current solve.
+   */
+  static int cv_jacobian_states(realtype t, N_Vector y, N_Vector fy,
+                                SUNMatrix J, void* user_data, N_Vector tmp1,
+                                N_Vector tmp2, N_Vector tmp3) {
+    ode_data* cvodes_data
+        = static_cast<cvodes_workspace*>(user_data)->cvodes_data_;
+    return ode_data::cv_jacobian_states(t, y, fy, J, cvodes_data, tmp1, tmp2,
+                                        tmp3);
+  }
+
+  void free_resources() {
+    if (cvodes_mem_ != nullptr) {
+      CVodeFree(&cvodes_mem_);
+    }
+    SUNLinSolFree(LS_);
+    SUNMatDestroy(A_);
+    N_VDestroy_Serial(nv_state_);
+    if (S_ > 0) {
+      N_VDestroyVectorArray_Serial(nv_state_sens_, S_);
+    }
+  }
+};
+
+}  // namespace math
+}  // namespace stan
+#endif
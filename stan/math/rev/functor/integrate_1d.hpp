@@ -7,6 +7,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/functor/integrate_1d.hpp>
 #include <type_traits>
@@ -19,24 +20,120 @@
 namespace stan {
 namespace math {
 
+namespace internal {
+
 /**
- * Calculate first derivative of f(x, param, std::ostream&)
- * with respect to the nth parameter. Uses nested reverse mode autodiff
+ * Value of an integrand together with its gradient with respect to the
+ * parameters, integrated componentwise by the Boost quadrature
+ * routines. The first component is the value.
+ *
+ * A default constructed object, or one constructed from zero, is empty
+ * and acts as a zero of any size, which is how the quadrature routines
+ * initialize their sums.
+ */
+class integrand_with_gradient {
+ public:
+  Eigen::VectorXd v_;
+
+  integrand_with_gradient() {}
+
+  integrand_with_gradient(double x)  // NOLINT(runtime/explicit)
+      : v_(x == 0 ? Eigen::VectorXd() : Eigen::VectorXd::Constant(1, x)) {}
+
+  explicit integrand_with_gradient(const Eigen::VectorXd& v) : v_(v) {}
+
+  inline integrand_with_gradient& operator+=(
+      const integrand_with_gradient& y) {
+    if (v_.size() == 0) {
+      v_ = y.v_;
+    } else if (y.v_.size() != 0) {
+      v_ += y.v_;
+    }
+    return *this;
+  }
+
+  inline integrand_with_gradient& operator-=(
+      const integrand_with_gradient& y) {
+    if (v_.size() == 0) {
+      v_ = -y.v_;
+    } else if (y.v_.size() != 0) {
+      v_ -= y.v_;
+    }
+    return *this;
+  }
+
+  inline integrand_with_gradient& operator*=(double c) {
+    v_ *= c;
+    return *this;
+  }
+
+  inline integrand_with_gradient& operator/=(double c) {
+    v_ /= c;
+    return *this;
+  }
+};
+
+inline integrand_with_gradient operator+(integrand_with_gradient x,
+                                         const integrand_with_gradient& y) {
+  return x += y;
+}
+
+inline integrand_with_gradient operator-(integrand_with_gradient x,
+                                         const integrand_with_gradient& y) {
+  return x -= y;
+}
+
+inline integrand_with_gradient operator-(integrand_with_gradient x) {
+  return x *= -1.0;
+}
+
+inline integrand_with_gradient operator*(integrand_with_gradient x, double c) {
+  return x *= c;
+}
+
+inline integrand_with_gradient operator*(double c, integrand_with_gradient x) {
+  return x *= c;
+}
+
+inline integrand_with_gradient operator/(integrand_with_gradient x, double c) {
+  return x /= c;
+}
+
+/**
+ * Return the norm used by the quadrature routines to assess
+ * convergence, which is the largest absolute value of the components.
+ *
+ * @param x value and gradient
+ * @return maximum norm
+ */
+inline double abs(const integrand_with_gradient& x) {
+  return x.v_.size() == 0 ? 0.0 : x.v_.cwiseAbs().maxCoeff();
+}
+
+inline std::ostream& operator<<(std::ostream& o,
+                                const integrand_with_gradient& x) {
+  return o << x.v_.transpose();
+}
+
+}  // namespace internal
+
+/**
+ * Calculate the value of f(x, param, std::ostream&) together with its
+ * first derivatives with respect to all parameters, using a single
+ * nested reverse mode sweep.
  *
  * Gradients that evaluate to NaN are set to zero if the function itself
- * evaluates to zero. If the function is not zero and the gradient evaluates to
+ * evaluates to zero. If the function is not zero and a gradient evaluates to
  * NaN, a std::domain_error is thrown
  *
  * @tparam F type of f
+ * @return vector holding the value followed by the gradient
  */
 template <typename F>
-inline double gradient_of_f(const F &f, const double &x, const double &xc,
-                            const std::vector<double> &theta_vals,
-                            const std::vector<double> &x_r,
-                            const std::vector<int> &x_i, size_t n,
-                            std::ostream *msgs) {
-  double gradient = 0.0;
-
+inline internal::integrand_with_gradient value_and_gradient_of_f(
+    const F &f, const double &x, const double &xc,
+    const std::vector<double> &theta_vals, const std::vector<double> &x_r,
+    const std::vector<int> &x_i, std::ostream *msgs) {
   // Run nested autodiff in this scope
   nested_rev_autodiff nested;
 
@@ -46,17 +143,45 @@ inline double gradient_of_f(const F &f, const double &x, const double &xc,
   }
   var fx = f(x, xc, theta_var, x_r, x_i, msgs);
   fx.grad();
-  gradient = theta_var[n].adj();
-  if (is_nan(gradient)) {
-    if (fx.val() == 0) {
-      gradient = 0;
-    } else {
-      throw_domain_error("gradient_of_f", "The gradient of f", n,
-                         "is nan for parameter ", "");
+
+  Eigen::VectorXd result(theta_vals.size() + 1);
+  result(0) = fx.val();
+  for (size_t n = 0; n < theta_vals.size(); ++n) {
+    double gradient = theta_var[n].adj();
+    if (is_nan(gradient)) {
+      if (fx.val() == 0) {
+        gradient = 0;
+      } else {
+        throw_domain_error("value_and_gradient_of_f", "The gradient of f",
+                           n, "is nan for parameter ", "");
+      }
     }
+    result(n + 1) = gradient;
   }
+  return internal::integrand_with_gradient(result);
+}
 
-  return gradient;
+/**
+ * Calculate first derivative of f(x, param, std::ostream&)
+ * with respect to the nth parameter. Uses nested reverse mode autodiff
+ *
+ * Gradients that evaluate to NaN are set to zero if the function itself
+ * evaluates to zero. If the function is not zero and the gradient evaluates to
+ * NaN, a std::domain_error is thrown
+ *
+ * @deprecated use <code>value_and_gradient_of_f</code>, which returns the
+ * whole gradient from the same nested sweep
+ *
+ * @tparam F type of f
+ */
+template <typename F>
+inline double gradient_of_f(const F &f, const double &x, const double &xc,
+                            const std::vector<double> &theta_vals,
+                            const std::vector<double> &x_r,
+                            const std::vector<int> &x_i, size_t n,
+                            std::ostream *msgs) {
+  return value_and_gradient_of_f(f, x, xc, theta_vals, x_r, x_i, msgs)
+      .v_(n + 1);
 }
 
 /**
@@ -94,6 +219,17 @@ inline double gradient_of_f(const F &f, const double &x, const double &xc,
  * split into two. In this case, each integral is separately integrated to the
  * given relative_tolerance.
  *
+ * If the parameters are autodiff variables, the integral and its gradient
+ * with respect to the parameters are integrated together on the same
+ * quadrature nodes, so that each node is evaluated only once, with a
+ * single nested reverse sweep. The norms in the termination criterion
+ * above are then the largest absolute value among the components of the
+ * integral and its gradient. Each component is therefore computed to
+ * within the relative tolerance times that largest absolute value, so
+ * a component much smaller than the others, e.g. the derivative with
+ * respect to a parameter f barely depends on, is only accurate in
+ * absolute terms.
+ *
  * Gradients of f that evaluate to NaN when the function evaluates to zero are
  * set to zero themselves. This is due to the autodiff easily overflowing to NaN
  * when evaluating gradients near the maximum and minimum floating point values
@@ -130,26 +266,30 @@ inline return_type_t<T_a, T_b, T_theta> integrate_1d(
     }
     return var(0.0);
   } else {
-    double integral = integrate(
-        std::bind<double>(f, std::placeholders::_1, std::placeholders::_2,
-                          value_of(theta), x_r, x_i, msgs),
-        value_of(a), value_of(b), relative_tolerance);
-
     size_t N_theta_vars = is_var<T_theta>::value ? theta.size() : 0;
     std::vector<double> dintegral_dtheta(N_theta_vars);
     std::vector<var> theta_concat(N_theta_vars);
+    double integral;
 
     if (N_theta_vars > 0) {
       std::vector<double> theta_vals = value_of(theta);
-
+      internal::integrand_with_gradient integral_and_gradient = integrate(
+          [&](double x, double xc) {
+            return value_and_gradient_of_f(f, x, xc, theta_vals, x_r, x_i,
+                                           msgs);
+          },
+          value_of(a), value_of(b), relative_tolerance);
+      const Eigen::VectorXd &v = integral_and_gradient.v_;
+      integral = v.size() == 0 ? 0.0 : v(0);
       for (size_t n = 0; n < N_theta_vars; ++n) {
-        dintegral_dtheta[n] = integrate(
-            std::bind<double>(gradient_of_f<F>, f, std::placeholders::_1,
-                              std::placeholders::_2, theta_vals, x_r, x_i, n,
-                              msgs),
-            value_of(a), value_of(b), relative_tolerance);
+        dintegral_dtheta[n] = v.size() == 0 ? 0.0 : v(n + 1);
         theta_concat[n] = theta[n];
       }
+    } else {
+      integral = integrate(
+          std::bind<double>(f, std::placeholders::_1, std::placeholders::_2,
+                            value_of(theta), x_r, x_i, msgs),
+          value_of(a), value_of(b), relative_tolerance);
     }
 
     if (!is_inf(a) && is_var<T_a>::value) {
@@ -0,0 +1,312 @@
+#ifndef STAN_MATH_REV_FUNCTOR_INTEGRATE_ODE_ADJOINT_HPP
+#define STAN_MATH_REV_FUNCTOR_INTEGRATE_ODE_ADJOINT_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/cvodes_integrator.hpp>
+#include <stan/math/rev/functor/cvodes_ode_adjoint_data.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <cvodes/cvodes.h>
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Vari holding the solution of an ODE whose gradient is computed with
+ * the adjoint method. The ODE solution at the output times is stored
+ * in non-chaining varis, while this vari is the only one placed on the
+ * chaining stack. Its <code>chain()</code> method solves the backward
+ * (adjoint) problem once, collecting the adjoints of all outputs, and
+ * propagates the result to the initial state, the parameters and the
+ * time points.
+ *
+ * @tparam F type of functor for the base ode system.
+ * @tparam T_initial type of scalars for initial values.
+ * @tparam T_param type of scalars for parameters.
+ * @tparam T_t0 type of scalar of initial time point.
+ * @tparam T_ts type of time-points where ODE solution is returned.
+ */
+template <typename F, typename T_initial, typename T_param, typename T_t0,
+          typename T_ts>
+class cvodes_ode_adjoint_vari : public vari {
+  const size_t N_;
+  const size_t M_;
+  const size_t num_ts_;
+  const double t0_dbl_;
+  double* ts_dbl_;
+  double* y0_dbl_;
+  vari** y0_varis_;
+  vari** theta_varis_;
+  vari** t0_varis_;
+  vari** ts_varis_;
+  vari** y_varis_;
+  cvodes_ode_adjoint_data<F>* data_;
+
+ public:
+  /**
+   * Construct the vari from the solution of the forward problem.
+   *
+   * @param[in] y0 initial state.
+   * @param[in] t0 initial time.
+   * @param[in] ts times of the solutions.
+   * @param[in] theta parameter vector for the ODE.
+   * @param[in] y solution of the ODE at the time points ts.
+   * @param[in] data CVODES adjoint data holding the forward solution.
+   */
+  cvodes_ode_adjoint_vari(const std::vector<T_initial>& y0, const T_t0& t0,
+                          const std::vector<T_ts>& ts,
+                          const std::vector<T_param>& theta,
+                          const std::vector<std::vector<double>>& y,
+                          cvodes_ode_adjoint_data<F>* data)
+      : vari(0.0),
+        N_(y0.size()),
+        M_(theta.size()),
+        num_ts_(ts.size()),
+        t0_dbl_(value_of(t0)),
+        ts_dbl_(ChainableStack::instance_->memalloc_.alloc_array<double>(
+            num_ts_)),
+        y0_dbl_(ChainableStack::instance_->memalloc_.alloc_array<double>(N_)),
+        y0_varis_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+            count_vars(y0))),
+        theta_varis_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+            count_vars(theta))),
+        t0_varis_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+            count_vars(t0))),
+        ts_varis_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+            count_vars(ts))),
+        y_varis_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+            N_ * num_ts_)),
+        data_(data) {
+    for (size_t n = 0; n < num_ts_; ++n) {
+      ts_dbl_[n] = value_of(ts[n]);
+      for (size_t i = 0; i < N_; ++i) {
+        y_varis_[N_ * n + i] = new vari(y[n][i], false);
+      }
+    }
+    for (size_t i = 0; i < N_; ++i) {
+      y0_dbl_[i] = value_of(y0[i]);
+    }
+    save_varis(y0_varis_, y0);
+    save_varis(theta_varis_, theta);
+    save_varis(t0_varis_, t0);
+    save_varis(ts_varis_, ts);
+  }
+
+  /**
+   * Return the ODE solution as vars.
+   *
+   * @return a vector of states, each state being a vector of the
+   * same size as the state variable, corresponding to a time in ts.
+   */
+  std::vector<std::vector<var>> solution() const {
+    std::vector<std::vector<var>> y(num_ts_, std::vector<var>(N_));
+    for (size_t n = 0; n < num_ts_; ++n) {
+      for (size_t i = 0; i < N_; ++i) {
+        y[n][i] = var(y_varis_[N_ * n + i]);
+      }
+    }
+    return y;
+  }
+
+  /**
+   * Solve the backward problem from the last to the initial time
+   * point. The adjoints of the outputs at each time point enter the
+   * adjoint state as jumps at the respective time.
+   */
+  void chain() {
+    std::vector<double>& lambda = data_->state_adj_;
+    std::fill(lambda.begin(), lambda.end(), 0.0);
+    std::fill(data_->quad_.begin(), data_->quad_.end(), 0.0);
+    std::vector<double> f_y(N_);
+
+    for (size_t n = num_ts_; n-- > 0;) {
+      vari** y_n_varis = y_varis_ + N_ * n;
+      for (size_t i = 0; i < N_; ++i) {
+        lambda[i] += y_n_varis[i]->adj_;
+      }
+
+      if (is_var<T_ts>::value) {
+        std::vector<double> y_n(N_);
+        for (size_t i = 0; i < N_; ++i) {
+          y_n[i] = y_n_varis[i]->val_;
+        }
+        data_->rhs(ts_dbl_[n], y_n.data(), f_y.data());
+        for (size_t i = 0; i < N_; ++i) {
+          ts_varis_[n]->adj_ += y_n_varis[i]->adj_ * f_y[i];
+        }
+      }
+
+      data_->integrate_backward(ts_dbl_[n], n > 0 ? ts_dbl_[n - 1] : t0_dbl_);
+    }
+
+    if (is_var<T_initial>::value) {
+      for (size_t i = 0; i < N_; ++i) {
+        y0_varis_[i]->adj_ += lambda[i];
+      }
+    }
+
+    if (is_var<T_param>::value) {
+      for (size_t j = 0; j < M_; ++j) {
+        theta_varis_[j]->adj_ += data_->quad_[j];
+      }
+    }
+
+    if (is_var<T_t0>::value) {
+      data_->rhs(t0_dbl_, y0_dbl_, f_y.data());
+      for (size_t i = 0; i < N_; ++i) {
+        t0_varis_[0]->adj_ -= lambda[i] * f_y[i];
+      }
+    }
+  }
+};
+
+}  // namespace internal
+
+/**
+ * Return the solutions for the specified system of ordinary
+ * differential equations given the specified initial state,
+ * initial times, times of desired solution, and parameters and
+ * data, writing error and warning messages to the specified
+ * stream. The gradient of the solution is computed with the adjoint
+ * sensitivity method.
+ *
+ * The ODE is solved with the BDF method of CVODES storing checkpoints
+ * of the forward solution. During the reverse sweep a single backward
+ * solve of the N adjoint states (plus M quadrature states for the
+ * parameters) is performed, rather than integrating the N + N * (N +
+ * M) states of the forward sensitivity system as done by
+ * <code>integrate_ode_bdf</code>. This is advantageous whenever the
+ * number of parameters is large.
+ *
+ * A checkpoint is stored every
+ * <code>num_steps_between_checkpoints</code> integration steps. The
+ * forward solution is recomputed between checkpoints during the
+ * backward solve, such that a larger value reduces memory use at the
+ * cost of additional computation.
+ *
+ * @tparam F type of ODE system function.
+ * @tparam T_initial type of scalars for initial values.
+ * @tparam T_param type of scalars for parameters.
+ * @tparam T_t0 type of scalar of initial time point.
+ * @tparam T_ts type of time-points where ODE solution is returned.
+ * @param[in] f functor for the base ordinary differential equation.
+ * @param[in] y0 initial state.
+ * @param[in] t0 initial time.
+ * @param[in] ts times of the desired solutions, in strictly
+ * increasing order, all greater than the initial time.
+ * @param[in] theta parameter vector for the ODE.
+ * @param[in] x continuous data vector for the ODE.
+ * @param[in] x_int integer data vector for the ODE.
+ * @param[in, out] msgs the print stream for warning messages.
+ * @param[in] relative_tolerance relative tolerance passed to CVODE.
+ * @param[in] absolute_tolerance absolute tolerance passed to CVODE.
+ * @param[in] max_num_steps maximal number of admissable steps
+ * between time-points
+ * @param[in] num_steps_between_checkpoints number of integration
+ * steps between checkpoints of the forward solution.
+ * @param[in] interpolation_polynomial type of interpolation of the
+ * forward solution between checkpoints (CV_HERMITE or CV_POLYNOMIAL).
+ * @return a vector of states, each state being a vector of the
+ * same size as the state variable, corresponding to a time in ts.
+ */
+template <typename F, typename T_initial, typename T_param, typename T_t0,
+          typename T_ts,
+          require_any_var_t<T_initial, T_param, T_t0, T_ts>* = nullptr>
+std::vector<std::vector<var>> integrate_ode_adjoint(
+    const F& f, const std::vector<T_initial>& y0, const T_t0& t0,
+    const std::vector<T_ts>& ts, const std::vector<T_param>& theta,
+    const std::vector<double>& x, const std::vector<int>& x_int,
+    std::ostream* msgs = nullptr, double relative_tolerance = 1e-10,
+    double absolute_tolerance = 1e-10,
+    long int max_num_steps = 1e8,                 // NOLINT(runtime/int)
+    long int num_steps_between_checkpoints = 150,  // NOLINT(runtime/int)
+    int interpolation_polynomial = CV_HERMITE) {
+  const char* fun = "integrate_ode_adjoint";
+
+  const double t0_dbl = value_of(t0);
+  const std::vector<double> ts_dbl = value_of(ts);
+
+  check_finite(fun, "initial state", y0);
+  check_finite(fun, "initial time", t0_dbl);
+  check_finite(fun, "times", ts_dbl);
+  check_finite(fun, "parameter vector", theta);
+  check_finite(fun, "continuous data", x);
+  check_nonzero_size(fun, "times", ts);
+  check_nonzero_size(fun, "initial state", y0);
+  check_ordered(fun, "times", ts_dbl);
+  check_less(fun, "initial time", t0_dbl, ts_dbl[0]);
+  if (relative_tolerance <= 0) {
+    invalid_argument(fun, "relative_tolerance,", relative_tolerance, "",
+                     ", must be greater than 0");
+  }
+  if (absolute_tolerance <= 0) {
+    invalid_argument(fun, "absolute_tolerance,", absolute_tolerance, "",
+                     ", must be greater than 0");
+  }
+  if (max_num_steps <= 0) {
+    invalid_argument(fun, "max_num_steps,", max_num_steps, "",
+                     ", must be greater than 0");
+  }
+  if (num_steps_between_checkpoints <= 0) {
+    invalid_argument(fun, "num_steps_between_checkpoints,",
+                     num_steps_between_checkpoints, "",
+                     ", must be greater than 0");
+  }
+  if (interpolation_polynomial != CV_HERMITE
+      && interpolation_polynomial != CV_POLYNOMIAL) {
+    invalid_argument(fun, "interpolation_polynomial,",
+                     interpolation_polynomial, "",
+                     ", must be CV_HERMITE or CV_POLYNOMIAL");
+  }
+
+  // the data object is managed by the autodiff memory as it must
+  // persist until the reverse sweep
+  auto* data = new cvodes_ode_adjoint_data<F>(
+      f, value_of(y0), value_of(theta), x, x_int, msgs,
+      is_var<T_param>::value);
+
+  const std::vector<std::vector<double>> y = data->integrate_forward(
+      t0_dbl, ts_dbl, relative_tolerance, absolute_tolerance, max_num_steps,
+      num_steps_between_checkpoints, interpolation_polynomial);
+
+  auto* adjoint_vari
+      = new internal::cvodes_ode_adjoint_vari<F, T_initial, T_param, T_t0,
+                                              T_ts>(y0, t0, ts, theta, y,
+                                                    data);
+  return adjoint_vari->solution();
+}
+
+/**
+ * Return the solutions for the specified system of ordinary
+ * differential equations for the case that no argument is an
+ * autodiff variable. No adjoint problem is required and the BDF
+ * solver of CVODES is used directly.
+ *
+ * See the var overload for a description of the arguments.
+ */
+template <typename F, typename T_initial, typename T_param, typename T_t0,
+          typename T_ts,
+          require_all_not_var_t<T_initial, T_param, T_t0, T_ts>* = nullptr>
+std::vector<std::vector<double>> integrate_ode_adjoint(
+    const F& f, const std::vector<T_initial>& y0, const T_t0& t0,
+    const std::vector<T_ts>& ts, const std::vector<T_param>& theta,
+    const std::vector<double>& x, const std::vector<int>& x_int,
+    std::ostream* msgs = nullptr, double relative_tolerance = 1e-10,
+    double absolute_tolerance = 1e-10,
+    long int max_num_steps = 1e8,                 // NOLINT(runtime/int)
+    long int num_steps_between_checkpoints = 150,  // NOLINT(runtime/int)
+    int interpolation_polynomial = CV_HERMITE) {
+  cvodes_integrator<CV_BDF> integrator;
+  return integrator.integrate(f, y0, t0, ts, theta, x, x_int, msgs,
+                              relative_tolerance, absolute_tolerance,
+                              max_num_steps);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
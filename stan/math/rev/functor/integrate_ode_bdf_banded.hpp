@@ -0,0 +1,53 @@
+#ifndef STAN_MATH_REV_FUNCTOR_INTEGRATE_ODE_BDF_BANDED_HPP
+#define STAN_MATH_REV_FUNCTOR_INTEGRATE_ODE_BDF_BANDED_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/functor/cvodes_integrator.hpp>
+#include <ostream>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the solutions of a stiff system of ordinary differential
+ * equations whose Jacobian wrt to the states is banded, as it is for
+ * spatially discretized PDEs. Entry (i, j) of the Jacobian may only be
+ * non-zero for <code>i - lower_bandwidth <= j <= i +
+ * upper_bandwidth</code>; a tridiagonal system has bandwidths 1 and 1.
+ *
+ * The BDF solver of CVODES then uses the band LU solver and the
+ * Jacobian is calculated with <code>lower_bandwidth + upper_bandwidth +
+ * 1</code> reverse sweeps instead of one per state, each of which sums
+ * rows that far apart. Derivatives outside of the band are therefore
+ * not dropped but added to entries of other rows. Understated
+ * bandwidths give a wrong Jacobian, with which the Newton iteration of
+ * the solver needs more steps or fails; they do not change the accuracy
+ * of a solution which is found. See <code>integrate_ode_bdf</code> for
+ * the remaining arguments.
+ *
+ * @param[in] lower_bandwidth lower bandwidth of the Jacobian.
+ * @param[in] upper_bandwidth upper bandwidth of the Jacobian.
+ * @throw std::domain_error if a bandwidth is negative.
+ */
+template <typename F, typename T_initial, typename T_param, typename T_t0,
+          typename T_ts>
+std::vector<std::vector<return_type_t<T_initial, T_param, T_t0, T_ts>>>
+integrate_ode_bdf_banded(const F& f, const std::vector<T_initial>& y0,
+                         const T_t0& t0, const std::vector<T_ts>& ts,
+                         const std::vector<T_param>& theta,
+                         const std::vector<double>& x,
+                         const std::vector<int>& x_int, int lower_bandwidth,
+                         int upper_bandwidth, std::ostream* msgs = nullptr,
+                         double relative_tolerance = 1e-10,
+                         double absolute_tolerance = 1e-10,
+                         long int max_num_steps = 1e8) {  // NOLINT(runtime/int)
+  stan::math::cvodes_integrator<CV_BDF> integrator;
+  return integrator.integrate(f, y0, t0, ts, theta, x, x_int, msgs,
+                              relative_tolerance, absolute_tolerance,
+                              max_num_steps, lower_bandwidth, upper_bandwidth);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
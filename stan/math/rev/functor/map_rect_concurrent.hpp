@@ -5,19 +5,172 @@
 #include <stan/math/prim/fun/typedefs.hpp>
 #include <stan/math/prim/functor/map_rect_concurrent.hpp>
 #include <stan/math/prim/functor/map_rect_reduce.hpp>
-#include <stan/math/prim/functor/map_rect_combine.hpp>
-#include <stan/math/rev/core/chainablestack.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
 
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
 
 #include <algorithm>
+#include <numeric>
 #include <vector>
 
 namespace stan {
 namespace math {
 namespace internal {
 
+/**
+ * This is a subclass of the vari class for all outputs of map_rect.
+ *
+ * The values of the outputs and their gradients with respect to the
+ * shared and job specific parameters, as returned by the reduce step
+ * of map_rect, are copied once into a single block of the arena. The
+ * adjoints of all outputs are propagated to the parameters in a single
+ * chain() call.
+ *
+ * @tparam T_shared_param type of shared parameters
+ * @tparam T_job_param type of job specific parameters
+ */
+template <typename T_shared_param, typename T_job_param>
+class map_rect_vari : public vari {
+ public:
+  int num_jobs_;
+  int num_shared_params_;
+  int num_job_params_;
+  int* job_output_end_;
+  double* output_;
+  vari** shared_params_vi_;
+  vari** job_params_vi_;
+  vari** result_vi_;
+
+  /**
+   * Constructor for map_rect_vari. All memory is allocated in the
+   * arena. The varis of the result are not put on the var stack as
+   * this vari propagates their adjoints.
+   *
+   * @param shared_params shared parameters of all jobs
+   * @param job_params job specific parameters
+   * @param world_f_out number of outputs of each job
+   * @param chunk_output outputs of consecutive chunks of jobs in the
+   * format of the reduce step, concatenated column-wise
+   */
+  map_rect_vari(
+      const Eigen::Matrix<T_shared_param, Eigen::Dynamic, 1>& shared_params,
+      const std::vector<Eigen::Matrix<T_job_param, Eigen::Dynamic, 1>>&
+          job_params,
+      const std::vector<int>& world_f_out,
+      const std::vector<std::vector<double>>& chunk_output)
+      : vari(0.0),
+        num_jobs_(job_params.size()),
+        num_shared_params_(is_var<T_shared_param>::value ? shared_params.size()
+                                                         : 0),
+        num_job_params_(is_var<T_job_param>::value ? job_params[0].size() : 0),
+        job_output_end_(
+            ChainableStack::instance_->memalloc_.alloc_array<int>(num_jobs_)),
+        output_(nullptr),
+        shared_params_vi_(
+            ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+                num_shared_params_)),
+        job_params_vi_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+            num_jobs_ * num_job_params_)),
+        result_vi_(nullptr) {
+    std::partial_sum(world_f_out.begin(), world_f_out.end(), job_output_end_);
+    const int num_outputs = job_output_end_[num_jobs_ - 1];
+    const int num_rows = 1 + num_shared_params_ + num_job_params_;
+
+    output_ = ChainableStack::instance_->memalloc_.alloc_array<double>(
+        num_rows * num_outputs);
+    double* output_end = output_;
+    for (const auto& chunk : chunk_output) {
+      output_end = std::copy(chunk.begin(), chunk.end(), output_end);
+    }
+
+    for (int j = 0; j < num_shared_params_; ++j) {
+      shared_params_vi_[j] = params_vi(shared_params.coeff(j));
+    }
+    for (int i = 0; i < num_jobs_; ++i) {
+      for (int j = 0; j < num_job_params_; ++j) {
+        job_params_vi_[i * num_job_params_ + j]
+            = params_vi(job_params[i].coeff(j));
+      }
+    }
+
+    result_vi_
+        = ChainableStack::instance_->memalloc_.alloc_array<vari*>(num_outputs);
+    for (int k = 0; k < num_outputs; ++k) {
+      result_vi_[k] = new vari(output_[k * num_rows], false);
+    }
+  }
+
+  virtual void chain() {
+    const int num_rows = 1 + num_shared_params_ + num_job_params_;
+    for (int i = 0, k = 0; i < num_jobs_; ++i) {
+      vari** job_params_vi = job_params_vi_ + i * num_job_params_;
+      for (; k < job_output_end_[i]; ++k) {
+        const double adj = result_vi_[k]->adj_;
+        const double* gradient = output_ + k * num_rows + 1;
+        for (int j = 0; j < num_shared_params_; ++j) {
+          shared_params_vi_[j]->adj_ += adj * gradient[j];
+        }
+        for (int j = 0; j < num_job_params_; ++j) {
+          job_params_vi[j]->adj_ += adj * gradient[num_shared_params_ + j];
+        }
+      }
+    }
+  }
+
+ private:
+  /**
+   * Return the vari of a parameter, or nullptr for data, whose
+   * gradients are not stored.
+   */
+  static inline vari* params_vi(const var& x) { return x.vi_; }
+  static inline vari* params_vi(double x) { return nullptr; }
+};
+
+/**
+ * Return the outputs of map_rect from the results of the reduce step
+ * for the case that all parameters are data.
+ */
+template <typename T_shared_param, typename T_job_param,
+          require_all_arithmetic_t<T_shared_param, T_job_param>* = nullptr>
+inline vector_d map_rect_collect(
+    const Eigen::Matrix<T_shared_param, Eigen::Dynamic, 1>& shared_params,
+    const std::vector<Eigen::Matrix<T_job_param, Eigen::Dynamic, 1>>&
+        job_params,
+    const std::vector<int>& world_f_out,
+    const std::vector<std::vector<double>>& chunk_output) {
+  vector_d out(std::accumulate(world_f_out.begin(), world_f_out.end(), 0));
+  double* out_end = out.data();
+  for (const auto& chunk : chunk_output) {
+    out_end = std::copy(chunk.begin(), chunk.end(), out_end);
+  }
+  return out;
+}
+
+/**
+ * Return the outputs of map_rect from the results of the reduce step
+ * for the case that the shared or the job specific parameters are
+ * autodiff variables. All outputs share a single map_rect_vari.
+ */
+template <typename T_shared_param, typename T_job_param,
+          require_any_var_t<T_shared_param, T_job_param>* = nullptr>
+inline vector_v map_rect_collect(
+    const Eigen::Matrix<T_shared_param, Eigen::Dynamic, 1>& shared_params,
+    const std::vector<Eigen::Matrix<T_job_param, Eigen::Dynamic, 1>>&
+        job_params,
+    const std::vector<int>& world_f_out,
+    const std::vector<std::vector<double>>& chunk_output) {
+  auto* baseVari = new map_rect_vari<T_shared_param, T_job_param>(
+      shared_params, job_params, world_f_out, chunk_output);
+  const int num_outputs = baseVari->job_output_end_[baseVari->num_jobs_ - 1];
+  vector_v out(num_outputs);
+  for (int k = 0; k < num_outputs; ++k) {
+    out.coeffRef(k).vi_ = baseVari->result_vi_[k];
+  }
+  return out;
+}
+
 template <int call_id, typename F, typename T_shared_param,
           typename T_job_param>
 Eigen::Matrix<return_type_t<T_shared_param, T_job_param>, Eigen::Dynamic, 1>
@@ -26,47 +179,40 @@ map_rect_concurrent(
     const std::vector<Eigen::Matrix<T_job_param, Eigen::Dynamic, 1>>&
         job_params,
     const std::vector<std::vector<double>>& x_r,
-    const std::vector<std::vector<int>>& x_i, std::ostream* msgs) {
+    const std::vector<std::vector<int>>& x_i, std::ostream* msgs,
+    int grainsize) {
   using ReduceF = map_rect_reduce<F, T_shared_param, T_job_param>;
-  using CombineF = map_rect_combine<F, T_shared_param, T_job_param>;
 
+  // jobs are processed in chunks of grainsize consecutive jobs and the
+  // results of each chunk are appended to a single buffer
   const int num_jobs = job_params.size();
+  const int num_chunks = (num_jobs + grainsize - 1) / grainsize;
   const vector_d shared_params_dbl = value_of(shared_params);
-  std::vector<matrix_d> job_output(num_jobs);
+  std::vector<std::vector<double>> chunk_output(num_chunks);
   std::vector<int> world_f_out(num_jobs, 0);
 
   auto execute_chunk = [&](std::size_t start, std::size_t end) -> void {
-    for (std::size_t i = start; i != end; ++i) {
-      job_output[i] = ReduceF()(shared_params_dbl, value_of(job_params[i]),
-                                x_r[i], x_i[i], msgs);
-      world_f_out[i] = job_output[i].cols();
+    for (std::size_t c = start; c != end; ++c) {
+      const std::size_t job_end
+          = std::min<std::size_t>((c + 1) * grainsize, num_jobs);
+      for (std::size_t i = c * grainsize; i != job_end; ++i) {
+        world_f_out[i] = ReduceF()(shared_params_dbl, value_of(job_params[i]),
+                                   x_r[i], x_i[i], chunk_output[c], msgs);
+      }
     }
   };
 
 #ifdef STAN_THREADS
-  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_jobs),
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_chunks),
                     [&](const tbb::blocked_range<size_t>& r) {
                       execute_chunk(r.begin(), r.end());
                     });
 #else
-  execute_chunk(0, num_jobs);
+  execute_chunk(0, num_chunks);
 #endif
 
-  // collect results
-  const int num_world_output
-      = std::accumulate(world_f_out.begin(), world_f_out.end(), 0);
-  matrix_d world_output(job_output[0].rows(), num_world_output);
-
-  int offset = 0;
-  for (const auto& job : job_output) {
-    const int num_job_outputs = job.cols();
-
-    world_output.block(0, offset, world_output.rows(), num_job_outputs) = job;
-
-    offset += num_job_outputs;
-  }
-  CombineF combine(shared_params, job_params);
-  return combine(world_output, world_f_out);
+  return map_rect_collect(shared_params, job_params, world_f_out,
+                          chunk_output);
 }
 
 }  // namespace internal
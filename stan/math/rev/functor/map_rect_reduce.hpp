@@ -15,14 +15,13 @@ namespace internal {
 
 template <typename F>
 struct map_rect_reduce<F, var, var> {
-  matrix_d operator()(const vector_d& shared_params,
-                      const vector_d& job_specific_params,
-                      const std::vector<double>& x_r,
-                      const std::vector<int>& x_i,
-                      std::ostream* msgs = nullptr) const {
+  int operator()(const vector_d& shared_params,
+                 const vector_d& job_specific_params,
+                 const std::vector<double>& x_r, const std::vector<int>& x_i,
+                 std::vector<double>& out, std::ostream* msgs = nullptr) const {
     const size_type num_shared_params = shared_params.rows();
     const size_type num_job_specific_params = job_specific_params.rows();
-    matrix_d out(1 + num_shared_params + num_job_specific_params, 0);
+    const size_type num_rows = 1 + num_shared_params + num_job_specific_params;
 
     // Run nested autodiff in this scope
     nested_rev_autodiff nested;
@@ -33,33 +32,47 @@ struct map_rect_reduce<F, var, var> {
     vector_v fx_v = F()(shared_params_v, job_specific_params_v, x_r, x_i, msgs);
 
     const size_type size_f = fx_v.rows();
+    const size_type offset = out.size();
 
-    out.resize(Eigen::NoChange, size_f);
+    out.resize(offset + num_rows * size_f);
 
     for (size_type i = 0; i < size_f; ++i) {
-      out(0, i) = fx_v(i).val();
+      double* out_i = out.data() + offset + i * num_rows;
+      out_i[0] = fx_v(i).val();
       nested.set_zero_all_adjoints();
       fx_v(i).grad();
       for (size_type j = 0; j < num_shared_params; ++j) {
-        out(1 + j, i) = shared_params_v(j).vi_->adj_;
+        out_i[1 + j] = shared_params_v(j).vi_->adj_;
       }
       for (size_type j = 0; j < num_job_specific_params; ++j) {
-        out(1 + num_shared_params + j, i) = job_specific_params_v(j).vi_->adj_;
+        out_i[1 + num_shared_params + j] = job_specific_params_v(j).vi_->adj_;
       }
     }
-    return out;
+    return size_f;
   }
-};
 
-template <typename F>
-struct map_rect_reduce<F, double, var> {
   matrix_d operator()(const vector_d& shared_params,
                       const vector_d& job_specific_params,
                       const std::vector<double>& x_r,
                       const std::vector<int>& x_i,
                       std::ostream* msgs = nullptr) const {
+    std::vector<double> out;
+    const int size_f
+        = (*this)(shared_params, job_specific_params, x_r, x_i, out, msgs);
+    return Eigen::Map<matrix_d>(
+        out.data(), 1 + shared_params.rows() + job_specific_params.rows(),
+        size_f);
+  }
+};
+
+template <typename F>
+struct map_rect_reduce<F, double, var> {
+  int operator()(const vector_d& shared_params,
+                 const vector_d& job_specific_params,
+                 const std::vector<double>& x_r, const std::vector<int>& x_i,
+                 std::vector<double>& out, std::ostream* msgs = nullptr) const {
     const size_type num_job_specific_params = job_specific_params.rows();
-    matrix_d out(1 + num_job_specific_params, 0);
+    const size_type num_rows = 1 + num_job_specific_params;
 
     // Run nested autodiff in this scope
     nested_rev_autodiff nested;
@@ -69,30 +82,43 @@ struct map_rect_reduce<F, double, var> {
     vector_v fx_v = F()(shared_params, job_specific_params_v, x_r, x_i, msgs);
 
     const size_type size_f = fx_v.rows();
+    const size_type offset = out.size();
 
-    out.resize(Eigen::NoChange, size_f);
+    out.resize(offset + num_rows * size_f);
 
     for (size_type i = 0; i < size_f; ++i) {
-      out(0, i) = fx_v(i).val();
+      double* out_i = out.data() + offset + i * num_rows;
+      out_i[0] = fx_v(i).val();
       nested.set_zero_all_adjoints();
       fx_v(i).grad();
       for (size_type j = 0; j < num_job_specific_params; ++j) {
-        out(1 + j, i) = job_specific_params_v(j).vi_->adj_;
+        out_i[1 + j] = job_specific_params_v(j).vi_->adj_;
       }
     }
-    return out;
+    return size_f;
   }
-};
 
-template <typename F>
-struct map_rect_reduce<F, var, double> {
   matrix_d operator()(const vector_d& shared_params,
                       const vector_d& job_specific_params,
                       const std::vector<double>& x_r,
                       const std::vector<int>& x_i,
                       std::ostream* msgs = nullptr) const {
+    std::vector<double> out;
+    const int size_f
+        = (*this)(shared_params, job_specific_params, x_r, x_i, out, msgs);
+    return Eigen::Map<matrix_d>(out.data(), 1 + job_specific_params.rows(),
+                                size_f);
+  }
+};
+
+template <typename F>
+struct map_rect_reduce<F, var, double> {
+  int operator()(const vector_d& shared_params,
+                 const vector_d& job_specific_params,
+                 const std::vector<double>& x_r, const std::vector<int>& x_i,
+                 std::vector<double>& out, std::ostream* msgs = nullptr) const {
     const size_type num_shared_params = shared_params.rows();
-    matrix_d out(1 + num_shared_params, 0);
+    const size_type num_rows = 1 + num_shared_params;
 
     // Run nested autodiff in this scope
     nested_rev_autodiff nested;
@@ -102,19 +128,31 @@ struct map_rect_reduce<F, var, double> {
     vector_v fx_v = F()(shared_params_v, job_specific_params, x_r, x_i, msgs);
 
     const size_type size_f = fx_v.rows();
+    const size_type offset = out.size();
 
-    out.resize(Eigen::NoChange, size_f);
+    out.resize(offset + num_rows * size_f);
 
     for (size_type i = 0; i < size_f; ++i) {
-      out(0, i) = fx_v(i).val();
+      double* out_i = out.data() + offset + i * num_rows;
+      out_i[0] = fx_v(i).val();
       nested.set_zero_all_adjoints();
       fx_v(i).grad();
       for (size_type j = 0; j < num_shared_params; ++j) {
-        out(1 + j, i) = shared_params_v(j).vi_->adj_;
+        out_i[1 + j] = shared_params_v(j).vi_->adj_;
       }
     }
+    return size_f;
+  }
 
-    return out;
+  matrix_d operator()(const vector_d& shared_params,
+                      const vector_d& job_specific_params,
+                      const std::vector<double>& x_r,
+                      const std::vector<int>& x_i,
+                      std::ostream* msgs = nullptr) const {
+    std::vector<double> out;
+    const int size_f
+        = (*this)(shared_params, job_specific_params, x_r, x_i, out, msgs);
+    return Eigen::Map<matrix_d>(out.data(), 1 + shared_params.rows(), size_f);
   }
 };
 
@@ -3,6 +3,7 @@
 
 #include <stan/math/rev/meta/apply_scalar_unary.hpp>
 #include <stan/math/rev/meta/is_var.hpp>
+#include <stan/math/rev/meta/is_var_matrix.hpp>
 #include <stan/math/rev/meta/partials_type.hpp>
 #include <stan/math/rev/meta/operands_and_partials.hpp>
 
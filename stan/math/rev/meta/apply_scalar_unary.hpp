@@ -2,11 +2,114 @@
 #define STAN_MATH_REV_META_APPLY_SCALAR_UNARY_HPP
 
 #include <stan/math/prim/meta/apply_scalar_unary.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/meta/is_eigen.hpp>
+#include <stan/math/prim/meta/is_var.hpp>
+#include <stan/math/prim/meta/plain_type.hpp>
+#include <stan/math/rev/core/chainablestack.hpp>
 #include <stan/math/rev/core/var.hpp>
+#include <stan/math/rev/core/vari.hpp>
+#include <type_traits>
+#include <vector>
 
 namespace stan {
 namespace math {
 
+/**
+ * Vectorized value and derivative of the unary function defined by the
+ * functor F. Specializations derive from <code>std::true_type</code> and
+ * define the static functions <code>value(x)</code> and
+ * <code>derivative(x, fx)</code> for Eigen arrays of doubles. For such
+ * F the reverse mode specializations of <code>apply_scalar_unary</code>
+ * evaluate F over a container of <code>var</code> with a single vari
+ * instead of one vari per element.
+ *
+ * @tparam F Type of function to apply.
+ */
+template <typename F>
+struct apply_scalar_unary_vectorized : std::false_type {};
+
+namespace internal {
+/**
+ * Vari of a unary function applied elementwise to a container of
+ * <code>var</code>. The values of the arguments and results are stored
+ * contiguously, such that <code>chain()</code> multiplies the adjoints
+ * of the results with the derivatives in one pass over arrays.
+ *
+ * @tparam F Type of function to apply.
+ */
+template <typename F>
+class apply_scalar_unary_vari : public vari {
+ public:
+  size_t size_;
+  double* x_;
+  double* fx_;
+  vari** x_vi_;
+  vari** fx_vi_;
+
+  apply_scalar_unary_vari(const var* x, size_t size)
+      : vari(0.0),
+        size_(size),
+        x_(ChainableStack::instance_->memalloc_.alloc_array<double>(size)),
+        fx_(ChainableStack::instance_->memalloc_.alloc_array<double>(size)),
+        x_vi_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(size)),
+        fx_vi_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(size)) {
+    for (size_t i = 0; i < size_; ++i) {
+      x_vi_[i] = x[i].vi_;
+      x_[i] = x[i].val();
+    }
+    Eigen::Map<Eigen::ArrayXd> fx(fx_, size_);
+    fx = apply_scalar_unary_vectorized<F>::value(
+        Eigen::Map<const Eigen::ArrayXd>(x_, size_));
+    for (size_t i = 0; i < size_; ++i) {
+      fx_vi_[i] = new vari(fx_[i], false);
+    }
+  }
+
+  void chain() {
+    Eigen::ArrayXd adj(size_);
+    for (size_t i = 0; i < size_; ++i) {
+      adj.coeffRef(i) = fx_vi_[i]->adj_;
+    }
+    adj *= apply_scalar_unary_vectorized<F>::derivative(
+        Eigen::Map<const Eigen::ArrayXd>(x_, size_),
+        Eigen::Map<const Eigen::ArrayXd>(fx_, size_));
+    for (size_t i = 0; i < size_; ++i) {
+      x_vi_[i]->adj_ += adj.coeff(i);
+    }
+  }
+};
+
+/**
+ * Apply the function defined by F to the contiguous <code>var</code>
+ * arguments, writing the results to <code>fx</code>. A single vari is
+ * created for all elements.
+ */
+template <typename F>
+inline void apply_scalar_unary_vec(const var* x, var* fx, size_t size,
+                                   std::true_type) {
+  if (size == 0) {
+    return;
+  }
+  auto* baseVari = new apply_scalar_unary_vari<F>(x, size);
+  for (size_t i = 0; i < size; ++i) {
+    fx[i] = var(baseVari->fx_vi_[i]);
+  }
+}
+
+/**
+ * Apply the function defined by F to each of the contiguous
+ * <code>var</code> arguments, writing the results to <code>fx</code>.
+ */
+template <typename F>
+inline void apply_scalar_unary_vec(const var* x, var* fx, size_t size,
+                                   std::false_type) {
+  for (size_t i = 0; i < size; ++i) {
+    fx[i] = F::fun(x[i]);
+  }
+}
+}  // namespace internal
+
 /**
  * Template specialization to var for vectorizing a unary scalar
  * function.  This is a base scalar specialization.  It applies
@@ -31,6 +134,70 @@ struct apply_scalar_unary<F, var> {
   static inline return_t apply(const var& x) { return F::fun(x); }
 };
 
+/**
+ * Template specialization for vectorizing a unary scalar function over
+ * Eigen matrices and expressions of <code>var</code>. If
+ * <code>apply_scalar_unary_vectorized</code> is specialized for F, a
+ * single vari is created for the whole matrix.
+ *
+ * @tparam F Type of function to apply.
+ * @tparam T Type of argument to which function is applied.
+ */
+template <typename F, typename T>
+struct apply_scalar_unary<F, T, require_eigen_vt<is_var, T>> {
+  /**
+   * Function return type, which is a plain matrix of <code>var</code>.
+   */
+  using return_t = plain_type_t<T>;
+
+  /**
+   * Apply the function specified by F elementwise to the specified
+   * argument.
+   *
+   * @param x Argument matrix.
+   * @return Elementwise application of F to the matrix.
+   */
+  static inline return_t apply(const T& x) {
+    const auto& x_eval = x.eval();
+    return_t fx(x_eval.rows(), x_eval.cols());
+    internal::apply_scalar_unary_vec<F>(x_eval.data(), fx.data(),
+                                        x_eval.size(),
+                                        apply_scalar_unary_vectorized<F>{});
+    return fx;
+  }
+};
+
+/**
+ * Template specialization for vectorizing a unary scalar function over
+ * a standard vector of <code>var</code>. If
+ * <code>apply_scalar_unary_vectorized</code> is specialized for F, a
+ * single vari is created for the whole vector.
+ *
+ * @tparam F Type of function to apply.
+ */
+template <typename F>
+struct apply_scalar_unary<F, std::vector<var>> {
+  /**
+   * Function return type, which is a standard vector of
+   * <code>var</code>.
+   */
+  using return_t = std::vector<var>;
+
+  /**
+   * Apply the function specified by F elementwise to the specified
+   * argument.
+   *
+   * @param x Argument vector.
+   * @return Elementwise application of F to the vector.
+   */
+  static inline return_t apply(const std::vector<var>& x) {
+    return_t fx(x.size());
+    internal::apply_scalar_unary_vec<F>(x.data(), fx.data(), x.size(),
+                                        apply_scalar_unary_vectorized<F>{});
+    return fx;
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,60 @@
+#ifndef STAN_MATH_REV_META_IS_VAR_MATRIX_HPP
+#define STAN_MATH_REV_META_IS_VAR_MATRIX_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/meta/is_var_matrix.hpp>
+#include <stan/math/rev/core/var_matrix.hpp>
+#include <type_traits>
+
+namespace stan {
+
+/** \ingroup type_trait
+ * Specialization for <code>var_matrix</code>.
+ */
+template <typename T>
+struct is_var_matrix<math::var_matrix<T>> : std::true_type {};
+
+/** \ingroup type_trait
+ * The scalar type of a matrix variable is <code>var</code>.
+ */
+template <typename T>
+struct scalar_type<T, std::enable_if_t<is_var_matrix<T>::value>> {
+  using type = math::var;
+};
+
+/** \ingroup type_trait
+ * Require type satisfies is_var_matrix
+ */
+template <typename T>
+using require_var_matrix_t = require_t<is_var_matrix<T>>;
+
+/** \ingroup type_trait
+ * Require at least one of the types satisfies is_var_matrix
+ */
+template <typename... Types>
+using require_any_var_matrix_t = require_any_t<is_var_matrix<Types>...>;
+
+/** \ingroup type_trait
+ * Require each type is either a var_matrix or an Eigen type with
+ * arithmetic scalars
+ */
+template <typename... Types>
+using require_all_var_matrix_or_eigen_t = require_all_t<math::disjunction<
+    is_var_matrix<Types>,
+    container_type_check_base<is_eigen, value_type_t, std::is_arithmetic,
+                              Types>>...>;
+
+/** \ingroup type_trait
+ * Require each type is either a var_matrix, an Eigen type with
+ * arithmetic scalars or a scalar
+ */
+template <typename... Types>
+using require_all_var_matrix_eigen_or_stan_scalar_t
+    = require_all_t<math::disjunction<
+        is_var_matrix<Types>,
+        container_type_check_base<is_eigen, value_type_t, std::is_arithmetic,
+                                  Types>,
+        is_stan_scalar<Types>>...>;
+
+}  // namespace stan
+#endif
@@ -0,0 +1,141 @@
+#ifndef STAN_MATH_REV_PROB_NORMAL_LPDF_HPP
+#define STAN_MATH_REV_PROB_NORMAL_LPDF_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/max_size.hpp>
+#include <stan/math/prim/fun/size.hpp>
+#include <stan/math/prim/prob/normal_lpdf.hpp>
+#include <cmath>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Return the inverse of a scalar scale.
+ *
+ * @param sigma scale
+ * @return inverse of the scale
+ */
+inline double normal_inv_sigma(double sigma) { return 1.0 / sigma; }
+
+/**
+ * Return the elementwise inverse of the scales, stored on the arena.
+ *
+ * @param sigma scales
+ * @return map of the inverses
+ */
+inline Eigen::Map<Eigen::ArrayXd> normal_inv_sigma(
+    const Eigen::Map<const Eigen::ArrayXd>& sigma) {
+  Eigen::Map<Eigen::ArrayXd> inv_sigma(
+      ChainableStack::instance_->memalloc_.alloc_array<double>(sigma.size()),
+      sigma.size());
+  inv_sigma = sigma.inverse();
+  return inv_sigma;
+}
+
+/**
+ * Return the sum of the logs of a scalar scale broadcast to N
+ * elements.
+ *
+ * @param sigma scale
+ * @param N number of elements
+ * @return sum of the logs
+ */
+inline double normal_sum_log_sigma(double sigma, size_t N) {
+  return std::log(sigma) * N;
+}
+
+/**
+ * Return the sum of the logs of the scales.
+ *
+ * @param sigma scales
+ * @param N number of elements, the size of the scales
+ * @return sum of the logs
+ */
+inline double normal_sum_log_sigma(
+    const Eigen::Map<const Eigen::ArrayXd>& sigma, size_t N) {
+  return sigma.log().sum();
+}
+}  // namespace internal
+
+/** \ingroup prob_dists
+ * The log of the normal density for the specified outcomes, locations
+ * and scales, at least one of which is a vector or matrix variable in
+ * struct-of-arrays form. Scalars are broadcast to the size of the
+ * other arguments and matrices are compared elementwise in column
+ * major order. The partials are added to the adjoints with vectorized
+ * updates in the reverse pass.
+ *
+ * @tparam propto if true, drop terms that do not depend on parameters
+ * @tparam T_y type of the outcomes, a var_matrix, an arithmetic Eigen
+ * type or a scalar
+ * @tparam T_loc type of the locations, a var_matrix, an arithmetic
+ * Eigen type or a scalar
+ * @tparam T_scale type of the scales, a var_matrix, an arithmetic Eigen
+ * type or a scalar
+ * @param y Random variables.
+ * @param mu Location parameters for the normal distribution.
+ * @param sigma Scale parameters for the normal distribution.
+ * @return The log of the product of the densities.
+ * @throw std::domain_error if a scale is not positive, a location is
+ * not finite or an outcome is NaN.
+ * @throw std::invalid_argument if the non-scalar arguments have
+ * different sizes.
+ */
+template <bool propto, typename T_y, typename T_loc, typename T_scale,
+          require_all_var_matrix_eigen_or_stan_scalar_t<T_y, T_loc,
+                                                        T_scale>* = nullptr,
+          require_any_var_matrix_t<T_y, T_loc, T_scale>* = nullptr>
+inline var normal_lpdf(const T_y& y, const T_loc& mu, const T_scale& sigma) {
+  static const char* function = "normal_lpdf";
+  const auto& y_val = internal::var_matrix_value(y);
+  const auto& mu_val = internal::var_matrix_value(mu);
+  const auto& sigma_val = internal::var_matrix_value(sigma);
+  check_not_nan(function, "Random variable", y_val);
+  check_finite(function, "Location parameter", mu_val);
+  check_positive(function, "Scale parameter", sigma_val);
+  check_consistent_sizes(function, "Random variable", y_val,
+                         "Location parameter", mu_val, "Scale parameter",
+                         sigma_val);
+  const size_t N = max_size(y_val, mu_val, sigma_val);
+  if (size(y_val) == 0 || size(mu_val) == 0 || size(sigma_val) == 0) {
+    return 0;
+  }
+
+  const auto sigma_flat = internal::flat_values(sigma);
+  const auto inv_sigma = internal::normal_inv_sigma(sigma_flat);
+  Eigen::Map<Eigen::ArrayXd> y_scaled(
+      ChainableStack::instance_->memalloc_.alloc_array<double>(N), N);
+  y_scaled = (internal::flat_values(y) - internal::flat_values(mu))
+             * inv_sigma;
+
+  double logp = -0.5 * y_scaled.square().sum();
+  if (include_summand<propto>::value) {
+    logp += NEG_LOG_SQRT_TWO_PI * N;
+  }
+  if (include_summand<propto, T_scale>::value) {
+    logp -= internal::normal_sum_log_sigma(sigma_flat, N);
+  }
+
+  auto y_op = internal::flat_operand(y);
+  auto mu_op = internal::flat_operand(mu);
+  auto sigma_op = internal::flat_operand(sigma);
+  return internal::make_callback_var(
+      logp,
+      [y_op, mu_op, sigma_op, y_scaled, inv_sigma](double adj) mutable {
+        const Eigen::ArrayXd mu_adj = adj * y_scaled * inv_sigma;
+        internal::add_flat_adj(y_op, -mu_adj);
+        internal::add_flat_adj(mu_op, mu_adj);
+        internal::add_flat_adj(sigma_op,
+                               mu_adj * y_scaled - adj * inv_sigma);
+      });
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,366 @@
+#ifndef TEST_BENCHMARKS_BENCHMARK_HPP
+#define TEST_BENCHMARKS_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * A minimal benchmark harness exposing the subset of the Google
+ * Benchmark API used by the benchmarks in this directory, so that they
+ * build with the bundled libraries only. The command line flags
+ * <code>--benchmark_filter</code>, <code>--benchmark_min_time</code>,
+ * <code>--benchmark_format</code> and <code>--benchmark_out</code>
+ * behave like their Google Benchmark counterparts, and the JSON output
+ * follows the Google Benchmark schema, so results can be compared with
+ * the usual tools.
+ */
+namespace benchmark {
+
+/**
+ * Prevent the compiler from optimizing away the computation of a value.
+ */
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Prevent the compiler from optimizing away writes to memory.
+ */
+inline void ClobberMemory() { asm volatile("" : : : "memory"); }
+
+/**
+ * State of a running benchmark, which controls the timed loop and
+ * provides the arguments of the benchmark.
+ */
+class State {
+ public:
+  State(int64_t max_iterations, std::vector<int64_t> args)
+      : max_iterations_(max_iterations),
+        iterations_(0),
+        args_(std::move(args)),
+        started_(false),
+        paused_(true) {}
+
+  /**
+   * Return true while the timed loop should continue. The clock starts
+   * with the first call and stops when the loop ends.
+   */
+  inline bool KeepRunning() {
+    if (!started_) {
+      started_ = true;
+      ResumeTiming();
+    }
+    if (iterations_ < max_iterations_) {
+      ++iterations_;
+      return true;
+    }
+    PauseTiming();
+    return false;
+  }
+
+  /**
+   * Stop the clock, e.g. to exclude setup code inside the loop.
+   */
+  inline void PauseTiming() {
+    if (!paused_) {
+      real_time_ += std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - real_start_)
+                        .count();
+      cpu_time_ += static_cast<double>(std::clock() - cpu_start_)
+                   / CLOCKS_PER_SEC;
+      paused_ = true;
+    }
+  }
+
+  /**
+   * Restart the clock after <code>PauseTiming()</code>.
+   */
+  inline void ResumeTiming() {
+    if (paused_) {
+      real_start_ = std::chrono::steady_clock::now();
+      cpu_start_ = std::clock();
+      paused_ = false;
+    }
+  }
+
+  /**
+   * Return the argument with the specified index.
+   */
+  inline int64_t range(size_t i = 0) const { return args_.at(i); }
+
+  inline int64_t iterations() const { return iterations_; }
+
+  inline double real_time() const { return real_time_; }
+
+  inline double cpu_time() const { return cpu_time_; }
+
+ private:
+  int64_t max_iterations_;
+  int64_t iterations_;
+  std::vector<int64_t> args_;
+  bool started_;
+  bool paused_;
+  double real_time_ = 0;
+  double cpu_time_ = 0;
+  std::chrono::steady_clock::time_point real_start_;
+  std::clock_t cpu_start_ = 0;
+};
+
+using Function = void (*)(State&);
+
+/**
+ * A registered benchmark, which is run once for each set of arguments.
+ */
+class Benchmark {
+ public:
+  Benchmark(const std::string& name, Function fn) : name_(name), fn_(fn) {}
+
+  /**
+   * Add a run with the specified argument.
+   */
+  Benchmark* Arg(int64_t x) {
+    args_.push_back({x});
+    return this;
+  }
+
+  /**
+   * Add a run with the specified arguments.
+   */
+  Benchmark* Args(const std::vector<int64_t>& x) {
+    args_.push_back(x);
+    return this;
+  }
+
+  /**
+   * Add runs with the powers of eight from <code>start</code> to
+   * <code>limit</code>, including both.
+   */
+  Benchmark* Range(int64_t start, int64_t limit) {
+    for (int64_t x = start; x < limit; x *= 8) {
+      Arg(x);
+    }
+    return Arg(limit);
+  }
+
+  const std::string& name() const { return name_; }
+  Function function() const { return fn_; }
+  const std::vector<std::vector<int64_t>>& args() const { return args_; }
+
+ private:
+  std::string name_;
+  Function fn_;
+  std::vector<std::vector<int64_t>> args_;
+};
+
+namespace internal {
+
+inline std::vector<std::unique_ptr<Benchmark>>& registry() {
+  static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+  return benchmarks;
+}
+
+struct Result {
+  std::string name;
+  int64_t iterations;
+  double real_time_ns;
+  double cpu_time_ns;
+};
+
+inline std::string run_name(const Benchmark& b,
+                            const std::vector<int64_t>& args) {
+  std::stringstream name;
+  name << b.name();
+  for (int64_t x : args) {
+    name << "/" << x;
+  }
+  return name.str();
+}
+
+/**
+ * Run a benchmark with increasing numbers of iterations until it takes
+ * at least the minimal time, as Google Benchmark does.
+ */
+inline Result run(const Benchmark& b, const std::vector<int64_t>& args,
+                  double min_time) {
+  int64_t iterations = 1;
+  while (true) {
+    State state(iterations, args);
+    b.function()(state);
+    const double time = state.real_time();
+    if (time >= min_time || iterations >= 1000000000) {
+      return {run_name(b, args), state.iterations(),
+              1e9 * time / state.iterations(),
+              1e9 * state.cpu_time() / state.iterations()};
+    }
+    double multiplier = time <= 0 ? 10 : 1.4 * min_time / time;
+    multiplier = std::min(10.0, std::max(multiplier, 2.0));
+    iterations = static_cast<int64_t>(iterations * multiplier);
+  }
+}
+
+inline std::string json_escape(const std::string& s) {
+  std::string out;
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+    }
+    out += c;
+  }
+  return out;
+}
+
+inline void write_json(std::ostream& o, const std::string& executable,
+                       const std::vector<Result>& results) {
+  std::time_t now = std::time(nullptr);
+  char date[64];
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+  o << "{\n"
+    << "  \"context\": {\n"
+    << "    \"date\": \"" << date << "\",\n"
+    << "    \"executable\": \"" << json_escape(executable) << "\",\n"
+    << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#ifdef NDEBUG
+    << "    \"library_build_type\": \"release\"\n"
+#else
+    << "    \"library_build_type\": \"debug\"\n"
+#endif
+    << "  },\n"
+    << "  \"benchmarks\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& r = results[i];
+    o << "    {\n"
+      << "      \"name\": \"" << json_escape(r.name) << "\",\n"
+      << "      \"run_name\": \"" << json_escape(r.name) << "\",\n"
+      << "      \"run_type\": \"iteration\",\n"
+      << "      \"iterations\": " << r.iterations << ",\n"
+      << "      \"real_time\": " << std::setprecision(10) << r.real_time_ns
+      << ",\n"
+      << "      \"cpu_time\": " << r.cpu_time_ns << ",\n"
+      << "      \"time_unit\": \"ns\"\n"
+      << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  o << "  ]\n"
+    << "}\n";
+}
+
+inline void write_console(std::ostream& o, const Result& r) {
+  o << std::left << std::setw(48) << r.name << std::right << std::setw(16)
+    << std::fixed << std::setprecision(0) << r.real_time_ns << " ns"
+    << std::setw(16) << r.cpu_time_ns << " ns" << std::setw(12)
+    << r.iterations << std::endl;
+}
+
+inline bool parse_flag(const std::string& arg, const std::string& flag,
+                       std::string* value) {
+  const std::string prefix = "--" + flag + "=";
+  if (arg.compare(0, prefix.size(), prefix) != 0) {
+    return false;
+  }
+  *value = arg.substr(prefix.size());
+  return true;
+}
+
+}  // namespace internal
+
+/**
+ * Register a benchmark under the specified name.
+ */
+inline Benchmark* RegisterBenchmark(const char* name, Function fn) {
+  internal::registry().emplace_back(new Benchmark(name, fn));
+  return internal::registry().back().get();
+}
+
+/**
+ * Run the registered benchmarks selected by the command line flags and
+ * report the results.
+ *
+ * @return 0 on success, 1 on invalid flags
+ */
+inline int RunSpecifiedBenchmarks(int argc, char** argv) {
+  std::string filter = ".";
+  std::string format = "console";
+  std::string out_file;
+  std::string min_time_str = "0.5";
+  for (int i = 1; i < argc; ++i) {
+    std::string arg(argv[i]);
+    if (!internal::parse_flag(arg, "benchmark_filter", &filter)
+        && !internal::parse_flag(arg, "benchmark_format", &format)
+        && !internal::parse_flag(arg, "benchmark_out", &out_file)
+        && !internal::parse_flag(arg, "benchmark_min_time", &min_time_str)) {
+      std::cerr << "unrecognized argument: " << arg << std::endl;
+      return 1;
+    }
+  }
+  if (format != "console" && format != "json") {
+    std::cerr << "unsupported --benchmark_format: " << format << std::endl;
+    return 1;
+  }
+  const double min_time = std::atof(min_time_str.c_str());
+  const std::regex filter_regex(filter);
+
+  const bool console = format == "console";
+  if (console) {
+    std::cout << std::left << std::setw(48) << "Benchmark" << std::right
+              << std::setw(19) << "Time" << std::setw(19) << "CPU"
+              << std::setw(12) << "Iterations" << std::endl;
+  }
+  std::vector<internal::Result> results;
+  for (const auto& b : internal::registry()) {
+    std::vector<std::vector<int64_t>> args = b->args();
+    if (args.empty()) {
+      args.push_back({});
+    }
+    for (const auto& a : args) {
+      if (!std::regex_search(internal::run_name(*b, a), filter_regex)) {
+        continue;
+      }
+      results.push_back(internal::run(*b, a, min_time));
+      if (console) {
+        internal::write_console(std::cout, results.back());
+      }
+    }
+  }
+  if (!console) {
+    internal::write_json(std::cout, argv[0], results);
+  }
+  if (!out_file.empty()) {
+    std::ofstream out(out_file);
+    internal::write_json(out, argv[0], results);
+  }
+  return 0;
+}
+
+}  // namespace benchmark
+
+#define BENCHMARK_PRIVATE_CONCAT2(a, b) a##b
+#define BENCHMARK_PRIVATE_CONCAT(a, b) BENCHMARK_PRIVATE_CONCAT2(a, b)
+
+/**
+ * Register a function <code>void fn(benchmark::State&)</code> as a
+ * benchmark. Arguments may be added by chaining calls to
+ * <code>Arg()</code>, <code>Args()</code> and <code>Range()</code>.
+ */
+#define BENCHMARK(fn)                                          \
+  static ::benchmark::Benchmark* BENCHMARK_PRIVATE_CONCAT(     \
+      benchmark_registration_, __LINE__) __attribute__((used)) \
+      = ::benchmark::RegisterBenchmark(#fn, fn)
+
+#define BENCHMARK_MAIN()                                  \
+  int main(int argc, char** argv) {                       \
+    return ::benchmark::RunSpecifiedBenchmarks(argc, argv); \
+  }
+
+#endif
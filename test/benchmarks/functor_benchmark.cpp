@@ -0,0 +1,108 @@
+#include <stan/math/rev.hpp>
+#include <test/benchmarks/benchmark.hpp>
+#include <ostream>
+#include <vector>
+
+// Gradients through the functionals, as a function of the number of ODE
+// states and of the number of map_rect jobs.
+
+// A chain of N compartments, each of which decays at rate theta[0] and
+// receives theta[1] times the content of the previous one.
+struct compartment_chain_ode {
+  template <typename T0, typename T1, typename T2>
+  std::vector<stan::return_type_t<T1, T2>> operator()(
+      const T0& t, const std::vector<T1>& y, const std::vector<T2>& theta,
+      const std::vector<double>& x, const std::vector<int>& x_int,
+      std::ostream* msgs) const {
+    std::vector<stan::return_type_t<T1, T2>> dydt(y.size());
+    dydt[0] = -theta[0] * y[0];
+    for (size_t i = 1; i < y.size(); ++i) {
+      dydt[i] = theta[1] * y[i - 1] - theta[0] * y[i];
+    }
+    return dydt;
+  }
+};
+
+static void integrate_ode_rk45_grad(benchmark::State& state) {
+  using stan::math::var;
+  const int N = state.range(0);
+  std::vector<double> y0(N, 1.0);
+  std::vector<double> ts;
+  for (int i = 1; i <= 10; ++i) {
+    ts.push_back(i);
+  }
+  std::vector<double> x;
+  std::vector<int> x_int;
+  Eigen::VectorXd theta(2);
+  theta << 0.5, 0.3;
+  double fx;
+  Eigen::VectorXd grad_fx;
+  auto f = [&](const Eigen::Matrix<var, -1, 1>& theta) {
+    std::vector<var> theta_v{theta(0), theta(1)};
+    std::vector<std::vector<var>> y = stan::math::integrate_ode_rk45(
+        compartment_chain_ode(), y0, 0.0, ts, theta_v, x, x_int);
+    var lp = 0;
+    for (const auto& y_t : y) {
+      lp += stan::math::sum(y_t);
+    }
+    return lp;
+  };
+  while (state.KeepRunning()) {
+    stan::math::gradient(f, theta, fx, grad_fx);
+    benchmark::DoNotOptimize(grad_fx.data());
+  }
+}
+BENCHMARK(integrate_ode_rk45_grad)->Arg(2)->Arg(8)->Arg(32);
+
+// The log likelihood of a logistic regression on the x_i[0] observations
+// of a job, with the shared intercept and slope in eta and the
+// observations and covariates packed into x_i and x_r.
+struct logistic_shard {
+  template <typename T1, typename T2>
+  Eigen::Matrix<stan::return_type_t<T1, T2>, Eigen::Dynamic, 1> operator()(
+      const Eigen::Matrix<T1, Eigen::Dynamic, 1>& eta,
+      const Eigen::Matrix<T2, Eigen::Dynamic, 1>& theta,
+      const std::vector<double>& x_r, const std::vector<int>& x_i,
+      std::ostream* msgs = nullptr) const {
+    const int M = x_i[0];
+    std::vector<int> y(x_i.begin() + 1, x_i.end());
+    Eigen::Map<const Eigen::VectorXd> x(x_r.data(), M);
+    Eigen::Matrix<stan::return_type_t<T1, T2>, Eigen::Dynamic, 1> lp(1);
+    lp(0) = stan::math::bernoulli_logit_lpmf(
+        y, stan::math::add(eta(0), stan::math::multiply(x, eta(1))));
+    return lp;
+  }
+};
+
+STAN_REGISTER_MAP_RECT(0, logistic_shard)
+
+static void map_rect_grad(benchmark::State& state) {
+  using stan::math::var;
+  const int J = state.range(0);
+  const int M = 100;
+  std::vector<Eigen::VectorXd> job_params(J, Eigen::VectorXd(0));
+  std::vector<std::vector<double>> x_r(J, std::vector<double>(M));
+  std::vector<std::vector<int>> x_i(J, std::vector<int>(M + 1));
+  for (int j = 0; j < J; ++j) {
+    x_i[j][0] = M;
+    for (int m = 0; m < M; ++m) {
+      x_r[j][m] = static_cast<double>(m) / M - 0.5;
+      x_i[j][m + 1] = (j + m) % 2;
+    }
+  }
+  Eigen::VectorXd theta(2);
+  theta << 0.2, -0.4;
+  double fx;
+  Eigen::VectorXd grad_fx;
+  auto f = [&](const Eigen::Matrix<var, -1, 1>& eta) {
+    return stan::math::sum(stan::math::map_rect<0, logistic_shard>(
+        eta, job_params, x_r, x_i));
+  };
+  while (state.KeepRunning()) {
+    stan::math::gradient(f, theta, fx, grad_fx);
+    benchmark::DoNotOptimize(grad_fx.data());
+  }
+}
+BENCHMARK(map_rect_grad)->Arg(4)->Arg(16)->Arg(64);
+
+BENCHMARK_MAIN();
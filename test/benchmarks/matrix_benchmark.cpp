@@ -0,0 +1,87 @@
+#include <stan/math/rev.hpp>
+#include <test/benchmarks/benchmark.hpp>
+#include <vector>
+
+// Gradients of the matrix functions used in latent variable and Gaussian
+// process models, as a function of the matrix dimension.
+
+static void multiply_grad(benchmark::State& state) {
+  using stan::math::var;
+  const int N = state.range(0);
+  Eigen::VectorXd theta = Eigen::VectorXd::Random(2 * N * N);
+  double fx;
+  Eigen::VectorXd grad_fx;
+  auto f = [&](const Eigen::Matrix<var, -1, 1>& theta) {
+    Eigen::Map<const Eigen::Matrix<var, -1, -1>> A(theta.data(), N, N);
+    Eigen::Map<const Eigen::Matrix<var, -1, -1>> B(theta.data() + N * N, N,
+                                                   N);
+    return stan::math::sum(stan::math::multiply(A, B));
+  };
+  while (state.KeepRunning()) {
+    stan::math::gradient(f, theta, fx, grad_fx);
+    benchmark::DoNotOptimize(grad_fx.data());
+  }
+}
+BENCHMARK(multiply_grad)->Arg(8)->Arg(32)->Arg(128);
+
+static void cholesky_decompose_grad(benchmark::State& state) {
+  using stan::math::var;
+  const int N = state.range(0);
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd Sigma = A * A.transpose();
+  Sigma.diagonal().array() += N;
+  Eigen::VectorXd theta = Eigen::Map<Eigen::VectorXd>(Sigma.data(), N * N);
+  double fx;
+  Eigen::VectorXd grad_fx;
+  auto f = [&](const Eigen::Matrix<var, -1, 1>& theta) {
+    Eigen::Map<const Eigen::Matrix<var, -1, -1>> Sigma(theta.data(), N, N);
+    Eigen::Matrix<var, -1, -1> L = stan::math::cholesky_decompose(
+        stan::math::multiply(0.5, Sigma + Sigma.transpose()));
+    return stan::math::sum(stan::math::log(L.diagonal()));
+  };
+  while (state.KeepRunning()) {
+    stan::math::gradient(f, theta, fx, grad_fx);
+    benchmark::DoNotOptimize(grad_fx.data());
+  }
+}
+BENCHMARK(cholesky_decompose_grad)->Arg(8)->Arg(32)->Arg(128);
+
+static void gp_exp_quad_cov_grad(benchmark::State& state) {
+  using stan::math::var;
+  const int N = state.range(0);
+  std::vector<double> x(N);
+  for (int n = 0; n < N; ++n) {
+    x[n] = static_cast<double>(n) / N;
+  }
+  Eigen::VectorXd theta(2);
+  theta << 0.5, -1.0;
+  double fx;
+  Eigen::VectorXd grad_fx;
+  auto f = [&](const Eigen::Matrix<var, -1, 1>& theta) {
+    return stan::math::sum(stan::math::gp_exp_quad_cov(
+        x, stan::math::exp(theta(0)), stan::math::exp(theta(1))));
+  };
+  while (state.KeepRunning()) {
+    stan::math::gradient(f, theta, fx, grad_fx);
+    benchmark::DoNotOptimize(grad_fx.data());
+  }
+}
+BENCHMARK(gp_exp_quad_cov_grad)->Arg(16)->Arg(64)->Arg(256);
+
+static void log_sum_exp_grad(benchmark::State& state) {
+  using stan::math::var;
+  const int N = state.range(0);
+  Eigen::VectorXd theta = Eigen::VectorXd::Random(N);
+  double fx;
+  Eigen::VectorXd grad_fx;
+  auto f = [&](const Eigen::Matrix<var, -1, 1>& theta) {
+    return stan::math::log_sum_exp(theta);
+  };
+  while (state.KeepRunning()) {
+    stan::math::gradient(f, theta, fx, grad_fx);
+    benchmark::DoNotOptimize(grad_fx.data());
+  }
+}
+BENCHMARK(log_sum_exp_grad)->Range(64, 32768);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,113 @@
+#include <stan/math/rev.hpp>
+#include <test/benchmarks/benchmark.hpp>
+#include <vector>
+
+// Gradients of the log densities that dominate typical regression
+// models, as a function of the number of observations.
+
+static void normal_lpdf_grad(benchmark::State& state) {
+  using stan::math::var;
+  const int N = state.range(0);
+  Eigen::VectorXd y = Eigen::VectorXd::Random(N);
+  Eigen::VectorXd theta(2);
+  theta << 0.1, -0.2;
+  double fx;
+  Eigen::VectorXd grad_fx;
+  auto f = [&](const Eigen::Matrix<var, -1, 1>& theta) {
+    return stan::math::normal_lpdf(y, theta(0), stan::math::exp(theta(1)));
+  };
+  while (state.KeepRunning()) {
+    stan::math::gradient(f, theta, fx, grad_fx);
+    benchmark::DoNotOptimize(grad_fx.data());
+  }
+}
+BENCHMARK(normal_lpdf_grad)->Range(64, 32768);
+
+static void normal_lpdf_vector_grad(benchmark::State& state) {
+  using stan::math::var;
+  const int N = state.range(0);
+  Eigen::VectorXd y = Eigen::VectorXd::Random(N);
+  Eigen::VectorXd theta = Eigen::VectorXd::Random(N);
+  double fx;
+  Eigen::VectorXd grad_fx;
+  auto f = [&](const Eigen::Matrix<var, -1, 1>& mu) {
+    return stan::math::normal_lpdf(y, mu, 1.5);
+  };
+  while (state.KeepRunning()) {
+    stan::math::gradient(f, theta, fx, grad_fx);
+    benchmark::DoNotOptimize(grad_fx.data());
+  }
+}
+BENCHMARK(normal_lpdf_vector_grad)->Range(64, 32768);
+
+// The GLM benchmarks use N observations of K = 10 covariates, with the
+// intercept, the coefficients and, for normal_id_glm, the scale as
+// parameters.
+
+static const int glm_K = 10;
+
+static void normal_id_glm_lpdf_grad(benchmark::State& state) {
+  using stan::math::var;
+  const int N = state.range(0);
+  Eigen::VectorXd y = Eigen::VectorXd::Random(N);
+  Eigen::MatrixXd x = Eigen::MatrixXd::Random(N, glm_K);
+  Eigen::VectorXd theta = 0.1 * Eigen::VectorXd::Random(glm_K + 2);
+  double fx;
+  Eigen::VectorXd grad_fx;
+  auto f = [&](const Eigen::Matrix<var, -1, 1>& theta) {
+    Eigen::Matrix<var, -1, 1> beta = theta.head(glm_K);
+    return stan::math::normal_id_glm_lpdf(y, x, theta(glm_K), beta,
+                                          stan::math::exp(theta(glm_K + 1)));
+  };
+  while (state.KeepRunning()) {
+    stan::math::gradient(f, theta, fx, grad_fx);
+    benchmark::DoNotOptimize(grad_fx.data());
+  }
+}
+BENCHMARK(normal_id_glm_lpdf_grad)->Range(64, 32768);
+
+static void bernoulli_logit_glm_lpmf_grad(benchmark::State& state) {
+  using stan::math::var;
+  const int N = state.range(0);
+  std::vector<int> y(N);
+  for (int n = 0; n < N; ++n) {
+    y[n] = n % 3 == 0;
+  }
+  Eigen::MatrixXd x = Eigen::MatrixXd::Random(N, glm_K);
+  Eigen::VectorXd theta = 0.1 * Eigen::VectorXd::Random(glm_K + 1);
+  double fx;
+  Eigen::VectorXd grad_fx;
+  auto f = [&](const Eigen::Matrix<var, -1, 1>& theta) {
+    Eigen::Matrix<var, -1, 1> beta = theta.head(glm_K);
+    return stan::math::bernoulli_logit_glm_lpmf(y, x, theta(glm_K), beta);
+  };
+  while (state.KeepRunning()) {
+    stan::math::gradient(f, theta, fx, grad_fx);
+    benchmark::DoNotOptimize(grad_fx.data());
+  }
+}
+BENCHMARK(bernoulli_logit_glm_lpmf_grad)->Range(64, 32768);
+
+static void poisson_log_glm_lpmf_grad(benchmark::State& state) {
+  using stan::math::var;
+  const int N = state.range(0);
+  std::vector<int> y(N);
+  for (int n = 0; n < N; ++n) {
+    y[n] = n % 5;
+  }
+  Eigen::MatrixXd x = Eigen::MatrixXd::Random(N, glm_K);
+  Eigen::VectorXd theta = 0.1 * Eigen::VectorXd::Random(glm_K + 1);
+  double fx;
+  Eigen::VectorXd grad_fx;
+  auto f = [&](const Eigen::Matrix<var, -1, 1>& theta) {
+    Eigen::Matrix<var, -1, 1> beta = theta.head(glm_K);
+    return stan::math::poisson_log_glm_lpmf(y, x, theta(glm_K), beta);
+  };
+  while (state.KeepRunning()) {
+    stan::math::gradient(f, theta, fx, grad_fx);
+    benchmark::DoNotOptimize(grad_fx.data());
+  }
+}
+BENCHMARK(poisson_log_glm_lpmf_grad)->Range(64, 32768);
+
+BENCHMARK_MAIN();
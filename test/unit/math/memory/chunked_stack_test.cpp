@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <stan/math/memory/chunked_stack.hpp>
+#include <vector>
+
+TEST(MemoryChunkedStack, pushAndIndex) {
+  stan::math::chunked_stack<int> stack;
+  EXPECT_TRUE(stack.empty());
+  EXPECT_EQ(0U, stack.bytes_allocated());
+  const int N = 3 * stan::math::chunked_stack<int>::chunk_size + 17;
+  for (int i = 0; i < N; ++i) {
+    stack.push_back(i);
+  }
+  EXPECT_EQ(N, stack.size());
+  EXPECT_EQ(N - 1, stack.back());
+  for (int i = 0; i < N; ++i) {
+    EXPECT_EQ(i, stack[i]);
+  }
+}
+
+TEST(MemoryChunkedStack, entriesDoNotMove) {
+  stan::math::chunked_stack<int> stack;
+  stack.push_back(42);
+  int* first = &stack[0];
+  for (size_t i = 0; i < 5 * stan::math::chunked_stack<int>::chunk_size; ++i) {
+    stack.push_back(0);
+  }
+  EXPECT_EQ(first, &stack[0]);
+  EXPECT_EQ(42, *first);
+}
+
+TEST(MemoryChunkedStack, resizeKeepsChunks) {
+  stan::math::chunked_stack<int> stack;
+  const size_t chunk_size = stan::math::chunked_stack<int>::chunk_size;
+  for (size_t n : {chunk_size - 1, chunk_size, chunk_size + 1, 2 * chunk_size,
+                   size_t(0)}) {
+    stack.clear();
+    for (size_t i = 0; i < 3 * chunk_size; ++i) {
+      stack.push_back(i);
+    }
+    size_t bytes = stack.bytes_allocated();
+    stack.resize(n);
+    EXPECT_EQ(n, stack.size());
+    EXPECT_EQ(bytes, stack.bytes_allocated());
+    stack.push_back(-1);
+    EXPECT_EQ(n + 1, stack.size());
+    EXPECT_EQ(-1, stack[n]);
+    if (n > 0) {
+      EXPECT_EQ(n - 1, stack[n - 1]);
+    }
+    EXPECT_EQ(bytes, stack.bytes_allocated());
+  }
+}
+
+TEST(MemoryChunkedStack, forEach) {
+  stan::math::chunked_stack<int> stack;
+  const int N = 2 * stan::math::chunked_stack<int>::chunk_size + 5;
+  for (int i = 0; i < N; ++i) {
+    stack.push_back(i);
+  }
+  std::vector<int> visited;
+  stack.for_each([&](int x) { visited.push_back(x); });
+  ASSERT_EQ(N, visited.size());
+  for (int i = 0; i < N; ++i) {
+    EXPECT_EQ(i, visited[i]);
+  }
+
+  const int begin = 3;
+  const int end = N - 2;
+  visited.clear();
+  stack.for_each(begin, end, [&](int x) { visited.push_back(x); });
+  ASSERT_EQ(end - begin, visited.size());
+  for (int i = 0; i < end - begin; ++i) {
+    EXPECT_EQ(begin + i, visited[i]);
+  }
+
+  visited.clear();
+  stack.for_each_reverse(begin, end, [&](int x) { visited.push_back(x); });
+  ASSERT_EQ(end - begin, visited.size());
+  for (int i = 0; i < end - begin; ++i) {
+    EXPECT_EQ(end - 1 - i, visited[i]);
+  }
+}
+
+TEST(MemoryChunkedStack, forEachReverseWithNestedPush) {
+  stan::math::chunked_stack<int> stack;
+  const int N = stan::math::chunked_stack<int>::chunk_size + 3;
+  for (int i = 0; i < N; ++i) {
+    stack.push_back(i);
+  }
+  int sum = 0;
+  stack.for_each_reverse(0, N, [&](int x) {
+    size_t size = stack.size();
+    for (int i = 0; i < N; ++i) {
+      stack.push_back(-1);
+    }
+    stack.resize(size);
+    sum += x;
+  });
+  EXPECT_EQ(N * (N - 1) / 2, sum);
+  EXPECT_EQ(N, stack.size());
+}
+
+TEST(MemoryChunkedStack, reserve) {
+  stan::math::chunked_stack<int> stack;
+  const size_t chunk_size = stan::math::chunked_stack<int>::chunk_size;
+  stack.reserve(2 * chunk_size + 1);
+  EXPECT_EQ(3 * chunk_size, stack.capacity());
+  EXPECT_TRUE(stack.empty());
+  for (size_t i = 0; i < 3 * chunk_size; ++i) {
+    stack.push_back(i);
+  }
+  EXPECT_EQ(3 * chunk_size, stack.capacity());
+  stack.reserve(chunk_size);
+  EXPECT_EQ(3 * chunk_size, stack.capacity());
+  EXPECT_EQ(3 * chunk_size, stack.size());
+}
+
+TEST(MemoryChunkedStack, high_water_mark) {
+  stan::math::chunked_stack<int> stack;
+  EXPECT_EQ(0U, stack.high_water_mark());
+  for (int i = 0; i < 100; ++i) {
+    stack.push_back(i);
+  }
+  EXPECT_EQ(0U, stack.high_water_mark());
+  stack.resize(40);
+  EXPECT_EQ(100U, stack.high_water_mark());
+  stack.clear();
+  EXPECT_EQ(100U, stack.high_water_mark());
+  stack.reserve(1000);
+  EXPECT_EQ(100U, stack.high_water_mark());
+}
@@ -119,3 +119,57 @@ TEST(stack_alloc, in_stack_second_block) {
   EXPECT_FALSE(allocator.in_stack(x));
   EXPECT_FALSE(allocator.in_stack(y));
 }
+
+TEST(stack_alloc, high_water_mark) {
+  stan::math::stack_alloc allocator;
+  EXPECT_EQ(0U, allocator.high_water_mark());
+  for (int i = 0; i < 100; ++i) {
+    allocator.alloc(1000);
+  }
+  EXPECT_EQ(0U, allocator.high_water_mark());
+  size_t in_use = allocator.bytes_in_use();
+  EXPECT_LE(100000U, in_use);
+  allocator.recover_all();
+  EXPECT_EQ(in_use, allocator.high_water_mark());
+  EXPECT_EQ(0U, allocator.bytes_in_use());
+
+  allocator.alloc(10);
+  allocator.recover_all();
+  EXPECT_EQ(in_use, allocator.high_water_mark());
+}
+
+TEST(stack_alloc, reserve) {
+  stan::math::stack_alloc allocator;
+  EXPECT_TRUE(allocator.reserve(10));
+  EXPECT_TRUE(allocator.reserve(1 << 20));
+  EXPECT_EQ(1 << 20, allocator.bytes_allocated());
+
+  char* first = static_cast<char*>(allocator.alloc(8));
+  for (int i = 0; i < 1000; ++i) {
+    char* x = static_cast<char*>(allocator.alloc(1000));
+    EXPECT_TRUE(allocator.in_stack(x));
+  }
+  // all allocations stay within the reserved block
+  EXPECT_EQ(1 << 20, allocator.bytes_allocated());
+  EXPECT_FALSE(allocator.reserve(1 << 21));
+
+  allocator.recover_all();
+  EXPECT_EQ(first, allocator.alloc(8));
+  allocator.recover_all();
+  allocator.free_all();
+  EXPECT_EQ(1 << 20, allocator.bytes_allocated());
+}
+
+TEST(stack_alloc, reserve_keeps_high_water_mark) {
+  stan::math::stack_alloc allocator;
+  allocator.alloc(1000);
+  allocator.recover_all();
+  size_t high_water_mark = allocator.high_water_mark();
+  EXPECT_LE(1000U, high_water_mark);
+
+  EXPECT_TRUE(allocator.reserve(1 << 20));
+  EXPECT_EQ(high_water_mark, allocator.high_water_mark());
+  EXPECT_EQ(0U, allocator.bytes_in_use());
+  allocator.recover_all();
+  EXPECT_EQ(high_water_mark, allocator.high_water_mark());
+}
@@ -0,0 +1,47 @@
+#include <test/unit/math/test_ad.hpp>
+#include <vector>
+
+TEST(MathMixMatFun, csrMatrixTimesVector) {
+  Eigen::MatrixXd a(3, 4);
+  a << 1.5, 0, -2, 0, 0, 0, 0, 0, 0.5, 3, 0, -1;
+  Eigen::SparseMatrix<double, Eigen::RowMajor> a_sparse = a.sparseView();
+  Eigen::VectorXd w = stan::math::csr_extract_w(a_sparse);
+  std::vector<int> v = stan::math::csr_extract_v(a_sparse);
+  std::vector<int> u = stan::math::csr_extract_u(a_sparse);
+
+  auto f = [&](const auto& w, const auto& b) {
+    return stan::math::csr_matrix_times_vector(3, 4, w, v, u, b);
+  };
+  Eigen::VectorXd b(4);
+  b << 2, -1, 0.5, 4;
+  stan::test::expect_ad(f, w, b);
+
+  Eigen::VectorXd b_bad(3);
+  b_bad << 2, -1, 0.5;
+  stan::test::expect_ad(f, w, b_bad);
+}
+
+TEST(MathMixMatFun, csrMatrixTimesVectorRepeatedColumns) {
+  using stan::math::var;
+  Eigen::VectorXd w(4);
+  w << 1, 2, 3, 4;
+  std::vector<int> v{1, 1, 2, 1};
+  std::vector<int> u{1, 3, 5};
+
+  Eigen::Matrix<var, Eigen::Dynamic, 1> w_v = w;
+  Eigen::Matrix<var, Eigen::Dynamic, 1> b_v(2);
+  b_v << 10, 20;
+  Eigen::Matrix<var, Eigen::Dynamic, 1> res
+      = stan::math::csr_matrix_times_vector(2, 2, w_v, v, u, b_v);
+  EXPECT_FLOAT_EQ(30, res(0).val());
+  EXPECT_FLOAT_EQ(100, res(1).val());
+
+  stan::math::sum(res).grad();
+  EXPECT_FLOAT_EQ(10, w_v(0).adj());
+  EXPECT_FLOAT_EQ(10, w_v(1).adj());
+  EXPECT_FLOAT_EQ(20, w_v(2).adj());
+  EXPECT_FLOAT_EQ(10, w_v(3).adj());
+  EXPECT_FLOAT_EQ(7, b_v(0).adj());
+  EXPECT_FLOAT_EQ(3, b_v(1).adj());
+  stan::math::recover_memory();
+}
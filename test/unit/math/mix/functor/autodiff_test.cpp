@@ -144,6 +144,65 @@ TEST(MixFunctor, jacobian) {
   EXPECT_FLOAT_EQ(6, J_rev(1, 1));
 }
 
+// quad_exp_fun(x) = 0.5 * x' * A * x + sum(exp(x))
+struct quad_exp_fun {
+  Matrix<double, Dynamic, Dynamic> A_;
+  explicit quad_exp_fun(const Matrix<double, Dynamic, Dynamic>& A) : A_(A) {}
+  template <typename T>
+  inline T operator()(const Matrix<T, Dynamic, 1>& x) const {
+    return 0.5 * stan::math::dot_product(x, stan::math::multiply(A_, x))
+           + stan::math::sum(stan::math::exp(x));
+  }
+};
+
+TEST(MixFunctor, hessianManyArguments) {
+  const int N = 40;
+  Matrix<double, Dynamic, Dynamic> A(N, N);
+  Matrix<double, Dynamic, 1> x(N);
+  for (int i = 0; i < N; ++i) {
+    x(i) = std::sin(i) / 2;
+    for (int j = 0; j < N; ++j) {
+      A(i, j) = std::cos(i + 2.0 * j);
+    }
+  }
+  quad_exp_fun f(A);
+  double fx(0);
+  Matrix<double, Dynamic, 1> grad;
+  Matrix<double, Dynamic, Dynamic> H;
+  stan::math::hessian(f, x, fx, grad, H);
+
+  Matrix<double, Dynamic, Dynamic> A_sym = 0.5 * (A + A.transpose());
+  EXPECT_FLOAT_EQ(f(x), fx);
+  Matrix<double, Dynamic, 1> grad_expected
+      = A_sym * x + x.array().exp().matrix();
+  Matrix<double, Dynamic, Dynamic> H_expected = A_sym;
+  H_expected.diagonal() += x.array().exp().matrix();
+  ASSERT_EQ(N, grad.size());
+  ASSERT_EQ(N, H.rows());
+  ASSERT_EQ(N, H.cols());
+  for (int i = 0; i < N; ++i) {
+    EXPECT_FLOAT_EQ(grad_expected(i), grad(i));
+    for (int j = 0; j < N; ++j) {
+      EXPECT_NEAR(H_expected(i, j), H(i, j), 1e-12);
+    }
+  }
+
+  double fx_par(0);
+  Matrix<double, Dynamic, 1> grad_par;
+  Matrix<double, Dynamic, Dynamic> H_par;
+  stan::math::hessian_parallel(f, x, fx_par, grad_par, H_par);
+  EXPECT_FLOAT_EQ(fx, fx_par);
+  ASSERT_EQ(N, grad_par.size());
+  ASSERT_EQ(N, H_par.rows());
+  ASSERT_EQ(N, H_par.cols());
+  for (int i = 0; i < N; ++i) {
+    EXPECT_FLOAT_EQ(grad(i), grad_par(i));
+    for (int j = 0; j < N; ++j) {
+      EXPECT_FLOAT_EQ(H(i, j), H_par(i, j));
+    }
+  }
+}
+
 TEST(MixFunctor, hessian) {
   fun1 f;
   Matrix<double, Dynamic, 1> x(2);
@@ -51,3 +51,34 @@ TEST(ErrorHandlingMatrix, CheckCorrMatrix_nan) {
     EXPECT_THROW(check_corr_matrix("test", "y", y), std::domain_error);
   }
 }
+
+TEST(ErrorHandlingMatrix, CheckCorrMatrix_ldlt) {
+  using stan::math::LDLT_factor;
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> y(3, 3);
+
+  y << 1, 0.5, 0.2, 0.5, 1, -0.3, 0.2, -0.3, 1;
+  LDLT_factor<double, Eigen::Dynamic, Eigen::Dynamic> ldlt_y(y);
+  EXPECT_NO_THROW(check_corr_matrix("test", "y", y, ldlt_y));
+
+  y << 1, 0.9, 0.9, 0.9, 1, -0.9, 0.9, -0.9, 1;
+  ldlt_y.compute(y);
+  EXPECT_THROW(check_corr_matrix("test", "y", y, ldlt_y), std::domain_error);
+
+  y << 1, 0.5, 0.2, 0.4, 1, -0.3, 0.2, -0.3, 1;
+  ldlt_y.compute(y);
+  EXPECT_THROW(check_corr_matrix("test", "y", y, ldlt_y), std::domain_error);
+
+  y << 2, 0.5, 0.2, 0.5, 1, -0.3, 0.2, -0.3, 1;
+  ldlt_y.compute(y);
+  EXPECT_THROW(check_corr_matrix("test", "y", y, ldlt_y), std::domain_error);
+
+  y(0, 0) = std::numeric_limits<double>::quiet_NaN();
+  ldlt_y.compute(y);
+  EXPECT_THROW(check_corr_matrix("test", "y", y, ldlt_y), std::domain_error);
+
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> y_rect(2, 3);
+  y_rect.setZero();
+  LDLT_factor<double, Eigen::Dynamic, Eigen::Dynamic> ldlt_rect;
+  EXPECT_THROW(check_corr_matrix("test", "y", y_rect, ldlt_rect),
+               std::invalid_argument);
+}
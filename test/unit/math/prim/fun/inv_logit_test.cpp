@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 TEST(MathFunctions, inv_logit) {
   using stan::math::inv_logit;
@@ -22,3 +23,26 @@ TEST(MathFunctions, inv_logit_works_with_other_functions) {
   b << 1.1, 1.2, 1.3, 1.4, 1.5;
   stan::math::multiply(a, stan::math::inv_logit(b));
 }
+
+TEST(MathFunctions, inv_logit_vectorized_matches_scalar) {
+  using stan::math::inv_logit;
+  double inf = std::numeric_limits<double>::infinity();
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  Eigen::VectorXd x(14);
+  x << -800, -40, -37, -36, -1e-7, 0, 1e-7, 1.5, 36, 40, 800, -inf, inf, nan;
+  Eigen::VectorXd y = inv_logit(x);
+  std::vector<double> x_std(x.data(), x.data() + x.size());
+  std::vector<double> y_std = inv_logit(x_std);
+  Eigen::RowVectorXd y_row = inv_logit(x.transpose());
+  for (int i = 0; i < x.size(); ++i) {
+    if (std::isnan(x(i))) {
+      EXPECT_TRUE(std::isnan(y(i)));
+      EXPECT_TRUE(std::isnan(y_std[i]));
+      EXPECT_TRUE(std::isnan(y_row(i)));
+    } else {
+      EXPECT_FLOAT_EQ(inv_logit(x(i)), y(i));
+      EXPECT_FLOAT_EQ(inv_logit(x(i)), y_std[i]);
+      EXPECT_FLOAT_EQ(inv_logit(x(i)), y_row(i));
+    }
+  }
+}
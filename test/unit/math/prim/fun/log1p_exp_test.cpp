@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 TEST(MathFunctions, log1p_exp) {
   using stan::math::log1p_exp;
@@ -24,3 +25,26 @@ TEST(MathFunctions, log1p_exp_works_with_other_functions) {
   b << 1.1, 1.2, 1.3, 1.4, 1.5;
   stan::math::multiply(a, stan::math::log1p_exp(b));
 }
+
+TEST(MathFunctions, log1p_exp_vectorized_matches_scalar) {
+  using stan::math::log1p_exp;
+  double inf = std::numeric_limits<double>::infinity();
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  Eigen::VectorXd x(13);
+  x << -10000, -800, -40, -1e-7, 0, 1e-7, 1.5, 40, 800, 10000, -inf, inf, nan;
+  Eigen::VectorXd y = log1p_exp(x);
+  std::vector<double> x_std(x.data(), x.data() + x.size());
+  std::vector<double> y_std = log1p_exp(x_std);
+  Eigen::RowVectorXd y_row = log1p_exp(x.transpose());
+  for (int i = 0; i < x.size(); ++i) {
+    if (std::isnan(x(i))) {
+      EXPECT_TRUE(std::isnan(y(i)));
+      EXPECT_TRUE(std::isnan(y_std[i]));
+      EXPECT_TRUE(std::isnan(y_row(i)));
+    } else {
+      EXPECT_FLOAT_EQ(log1p_exp(x(i)), y(i));
+      EXPECT_FLOAT_EQ(log1p_exp(x(i)), y_std[i]);
+      EXPECT_FLOAT_EQ(log1p_exp(x(i)), y_row(i));
+    }
+  }
+}
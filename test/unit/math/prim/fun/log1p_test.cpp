@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <limits>
+#include <vector>
 #include <stdexcept>
 
 TEST(MathFunctions, log1p) {
@@ -48,3 +49,29 @@ TEST(MathFunctions, log1p_works_with_other_functions) {
   b << 1.1, 1.2, 1.3, 1.4, 1.5;
   stan::math::multiply(a, stan::math::log1p(b));
 }
+
+TEST(MathFunctions, log1p_vectorized_matches_scalar) {
+  using stan::math::log1p;
+  double inf = std::numeric_limits<double>::infinity();
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  Eigen::VectorXd x(9);
+  x << -1, -0.999, -1e-7, 0, 1e-7, 0.1, 10, 1e10, nan;
+  Eigen::VectorXd y = log1p(x);
+  std::vector<double> x_std(x.data(), x.data() + x.size());
+  std::vector<double> y_std = log1p(x_std);
+  Eigen::RowVectorXd y_row = log1p(x.transpose());
+  for (int i = 0; i < x.size(); ++i) {
+    if (std::isnan(x(i))) {
+      EXPECT_TRUE(std::isnan(y(i)));
+      EXPECT_TRUE(std::isnan(y_std[i]));
+      EXPECT_TRUE(std::isnan(y_row(i)));
+    } else {
+      EXPECT_FLOAT_EQ(log1p(x(i)), y(i));
+      EXPECT_FLOAT_EQ(log1p(x(i)), y_std[i]);
+      EXPECT_FLOAT_EQ(log1p(x(i)), y_row(i));
+    }
+  }
+  Eigen::VectorXd bad(3);
+  bad << 0.5, -10, nan;
+  EXPECT_THROW(stan::math::log1p(bad), std::domain_error);
+}
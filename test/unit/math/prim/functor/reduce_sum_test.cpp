@@ -0,0 +1,116 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+struct count_lpdf {
+  template <typename T>
+  inline T operator()(const std::vector<int>& sub_slice, std::size_t start,
+                      std::size_t end, std::ostream* msgs,
+                      const std::vector<T>& lambda,
+                      const std::vector<int>& idata) const {
+    return stan::math::poisson_lpmf(sub_slice, lambda[0]);
+  }
+};
+
+struct slice_sum {
+  template <typename T>
+  inline T operator()(const std::vector<T>& sub_slice, std::size_t start,
+                      std::size_t end, std::ostream* msgs) const {
+    EXPECT_EQ(end - start + 1, sub_slice.size());
+    return stan::math::sum(sub_slice);
+  }
+};
+
+struct start_end_sum {
+  inline double operator()(const std::vector<int>& sub_slice,
+                           std::size_t start, std::size_t end,
+                           std::ostream* msgs,
+                           const std::vector<double>& data) const {
+    double sum = 0;
+    for (std::size_t i = start; i <= end; ++i) {
+      sum += data[i];
+    }
+    return sum;
+  }
+};
+
+TEST(StanMathPrim_reduce_sum, value) {
+  stan::math::init_threadpool_tbb();
+
+  double lambda_d = 10.0;
+  const std::size_t elems = 10000;
+  std::vector<int> data(elems);
+
+  for (std::size_t i = 0; i != elems; ++i) {
+    data[i] = i;
+  }
+
+  std::vector<int> idata;
+  std::vector<double> vlambda_d(1, lambda_d);
+
+  double poisson_lpdf = stan::math::reduce_sum<count_lpdf>(
+      data, 5, nullptr, vlambda_d, idata);
+
+  double poisson_lpdf_ref = stan::math::poisson_lpmf(data, lambda_d);
+
+  EXPECT_FLOAT_EQ(poisson_lpdf, poisson_lpdf_ref)
+      << "ref value of poisson lpdf : " << poisson_lpdf_ref << std::endl
+      << "value of poisson lpdf : " << poisson_lpdf << std::endl;
+
+  double poisson_lpdf_static = stan::math::reduce_sum_static<count_lpdf>(
+      data, 5, nullptr, vlambda_d, idata);
+
+  EXPECT_FLOAT_EQ(poisson_lpdf_static, poisson_lpdf_ref);
+}
+
+TEST(StanMathPrim_reduce_sum, grainsize) {
+  stan::math::init_threadpool_tbb();
+
+  std::vector<double> data(1000);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = i;
+  }
+  double ref = stan::math::sum(data);
+
+  for (int grainsize : {1, 2, 7, 100, 999, 1000, 5000}) {
+    EXPECT_FLOAT_EQ(ref, stan::math::reduce_sum<slice_sum>(data, grainsize,
+                                                             nullptr));
+    EXPECT_FLOAT_EQ(ref, stan::math::reduce_sum_static<slice_sum>(
+                             data, grainsize, nullptr));
+  }
+
+  EXPECT_THROW(stan::math::reduce_sum<slice_sum>(data, 0, nullptr),
+               std::domain_error);
+  EXPECT_THROW(stan::math::reduce_sum<slice_sum>(data, -1, nullptr),
+               std::domain_error);
+  EXPECT_THROW(stan::math::reduce_sum_static<slice_sum>(data, 0, nullptr),
+               std::domain_error);
+}
+
+TEST(StanMathPrim_reduce_sum, start_end) {
+  stan::math::init_threadpool_tbb();
+
+  std::vector<int> idx(100);
+  std::vector<double> data(100);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    idx[i] = i;
+    data[i] = i * i;
+  }
+  double ref = stan::math::sum(data);
+
+  EXPECT_FLOAT_EQ(ref,
+                  stan::math::reduce_sum<start_end_sum>(idx, 3, nullptr, data));
+  EXPECT_FLOAT_EQ(ref, stan::math::reduce_sum_static<start_end_sum>(
+                           idx, 3, nullptr, data));
+}
+
+TEST(StanMathPrim_reduce_sum, empty) {
+  stan::math::init_threadpool_tbb();
+
+  std::vector<double> data;
+  EXPECT_FLOAT_EQ(0.0, stan::math::reduce_sum<slice_sum>(data, 1, nullptr));
+  EXPECT_FLOAT_EQ(0.0,
+                  stan::math::reduce_sum_static<slice_sum>(data, 1, nullptr));
+}
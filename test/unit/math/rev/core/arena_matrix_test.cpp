@@ -0,0 +1,85 @@
+#include <stan/math/rev/core.hpp>
+#include <gtest/gtest.h>
+
+template <typename T1, typename T2>
+void expect_matrix_eq(const T1& a, const T2& b) {
+  Eigen::MatrixXd a_eval = a;
+  Eigen::MatrixXd b_eval = b;
+  ASSERT_EQ(a_eval.rows(), b_eval.rows());
+  ASSERT_EQ(a_eval.cols(), b_eval.cols());
+  for (int i = 0; i < a_eval.size(); ++i) {
+    EXPECT_FLOAT_EQ(a_eval(i), b_eval(i));
+  }
+}
+
+TEST(AgradRev, arena_matrix_matrix_test) {
+  using Eigen::MatrixXd;
+  using stan::math::arena_matrix;
+
+  // construction
+  arena_matrix<MatrixXd> a;
+  EXPECT_EQ(0, a.size());
+  arena_matrix<MatrixXd> a2;
+  arena_matrix<MatrixXd> a3;
+  arena_matrix<MatrixXd> b(3, 2);
+  arena_matrix<MatrixXd> b2(4, 5);
+  arena_matrix<MatrixXd> c(MatrixXd::Ones(3, 2));
+  arena_matrix<MatrixXd> d(c);
+  arena_matrix<MatrixXd> e(2 * d);
+
+  EXPECT_TRUE(stan::math::ChainableStack::instance_->memalloc_.in_stack(
+      b.data()));
+  EXPECT_TRUE(stan::math::ChainableStack::instance_->memalloc_.in_stack(
+      c.data()));
+
+  // assignment
+  a = c;
+  a2 = std::move(d);
+  a3 = 2 * a;
+  b = d;
+  b2 = std::move(c);
+  e = e + a;
+  a = MatrixXd::Ones(3, 2);
+
+  expect_matrix_eq(a + a2 + a3 + b + b2 + e, MatrixXd::Ones(3, 2) * 9);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, arena_matrix_vector_test) {
+  using Eigen::VectorXd;
+  using stan::math::arena_matrix;
+
+  arena_matrix<VectorXd> a;
+  arena_matrix<VectorXd> b(3);
+  arena_matrix<VectorXd> c(VectorXd::Ones(3));
+  arena_matrix<VectorXd> d(Eigen::RowVectorXd::Ones(3));
+
+  a = c;
+  b = 2 * d;
+  EXPECT_EQ(3, d.rows());
+  EXPECT_EQ(1, d.cols());
+  expect_matrix_eq(a + b + c + d, VectorXd::Ones(3) * 5);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, arena_matrix_shallow_copy_test) {
+  using Eigen::VectorXd;
+  using stan::math::arena_matrix;
+
+  arena_matrix<VectorXd> a(VectorXd::Zero(3));
+  arena_matrix<VectorXd> b(a);
+  arena_matrix<VectorXd> c;
+  c = a;
+  EXPECT_EQ(a.data(), b.data());
+  EXPECT_EQ(a.data(), c.data());
+
+  // compound assignment is in place
+  b += VectorXd::Ones(3);
+  expect_matrix_eq(a, VectorXd::Ones(3));
+
+  // assigning an expression allocates new memory
+  c = 2 * a;
+  EXPECT_NE(a.data(), c.data());
+  expect_matrix_eq(a, VectorXd::Ones(3));
+  stan::math::recover_memory();
+}
@@ -0,0 +1,110 @@
+#define STAN_AD_PROFILE
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+TEST(AgradRevProfile, counts_varis_by_function) {
+  using stan::math::matrix_v;
+  using stan::math::var;
+  stan::math::recover_memory();
+  stan::math::reset_profile();
+
+  Eigen::MatrixXd A_d(3, 3);
+  A_d << 4, 1, 0.5, 1, 3, 0.2, 0.5, 0.2, 2;
+  matrix_v A = A_d;
+  matrix_v L = stan::math::cholesky_decompose(A);
+  matrix_v LLt = stan::math::multiply(L, L.transpose());
+  var lp = LLt.sum();
+  lp.grad();
+
+  const auto results = stan::math::profile_results();
+  ASSERT_EQ(1, results.count("cholesky_decompose"));
+  ASSERT_EQ(1, results.count("multiply"));
+  ASSERT_EQ(1, results.count(""));
+
+  const auto& chol = results.at("cholesky_decompose");
+  EXPECT_EQ(1, chol.calls_);
+  EXPECT_GT(chol.chain_varis_ + chol.nochain_varis_, 0);
+  EXPECT_GT(chol.arena_bytes_, 0);
+  EXPECT_GE(chol.forward_time_, 0);
+  EXPECT_GE(chol.chain_time_, 0);
+
+  // the operands, the sum and its terms are created outside of
+  // profiled functions
+  const auto& rest = results.at("");
+  EXPECT_EQ(0, rest.calls_);
+  EXPECT_GE(rest.chain_varis_ + rest.nochain_varis_, A.size());
+
+  size_t chain_varis = 0;
+  size_t nochain_varis = 0;
+  for (const auto& entry : results) {
+    chain_varis += entry.second.chain_varis_;
+    nochain_varis += entry.second.nochain_varis_;
+  }
+  EXPECT_EQ(stan::math::ChainableStack::instance_->var_stack_.size(),
+            chain_varis);
+  EXPECT_EQ(stan::math::ChainableStack::instance_->var_nochain_stack_.size(),
+            nochain_varis);
+
+  std::stringstream out;
+  stan::math::print_profile(out);
+  EXPECT_NE(std::string::npos, out.str().find("cholesky_decompose"));
+  EXPECT_NE(std::string::npos, out.str().find("(not profiled)"));
+
+  stan::math::recover_memory();
+  stan::math::reset_profile();
+  EXPECT_TRUE(stan::math::profile_results().empty());
+}
+
+TEST(AgradRevProfile, nested_scopes_are_exclusive) {
+  using stan::math::var;
+  stan::math::recover_memory();
+  stan::math::reset_profile();
+  {
+    stan::math::profile_scope outer("outer");
+    var a = 1.0;
+    {
+      stan::math::profile_scope inner("inner");
+      var b = a * 2.0;
+      var c = b + 1.0;
+      c.grad();
+    }
+    var d = a * 3.0;
+    EXPECT_FLOAT_EQ(3.0, d.val());
+  }
+
+  // a and d belong to the outer scope, b and c to the inner scope
+  const auto results = stan::math::profile_results();
+  const auto& outer = results.at("outer");
+  const auto& inner = results.at("inner");
+  EXPECT_EQ(1, outer.calls_);
+  EXPECT_EQ(2, outer.chain_varis_ + outer.nochain_varis_);
+  EXPECT_EQ(1, inner.calls_);
+  EXPECT_EQ(2, inner.chain_varis_ + inner.nochain_varis_);
+  EXPECT_EQ(0, results.count(""));
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevProfile, nested_autodiff) {
+  using stan::math::var;
+  stan::math::recover_memory();
+  stan::math::reset_profile();
+  var a = 2.0;
+  stan::math::start_nested();
+  {
+    stan::math::profile_scope scope("nested");
+    var b = a * a;
+    b.grad();
+  }
+  EXPECT_FLOAT_EQ(4.0, a.adj());
+  stan::math::recover_memory_nested();
+  EXPECT_EQ(stan::math::ChainableStack::instance_->var_stack_.size(),
+            stan::math::ChainableStack::instance_->var_stack_profile_.size());
+
+  var c = a * 5.0;
+  c.grad();
+  EXPECT_FLOAT_EQ(9.0, a.adj());
+  EXPECT_EQ(1, stan::math::profile_results().at("nested").chain_varis_);
+  stan::math::recover_memory();
+}
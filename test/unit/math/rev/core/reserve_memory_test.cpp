@@ -0,0 +1,51 @@
+#include <stan/math/rev/core.hpp>
+#include <gtest/gtest.h>
+
+TEST(AgradRev, memory_high_water_mark) {
+  using stan::math::var;
+  stan::math::recover_memory();
+  var x = 1.5;
+  var y = x;
+  for (int i = 0; i < 100000; ++i) {
+    y = y * x;
+  }
+  size_t stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  stan::math::recover_memory();
+
+  stan::math::autodiff_memory_size size = stan::math::memory_high_water_mark();
+  EXPECT_LE(100000U * sizeof(stan::math::vari), size.arena_bytes);
+  EXPECT_EQ(stack_size, size.var_stack_size);
+}
+
+TEST(AgradRev, reserve_memory) {
+  using stan::math::var;
+  stan::math::recover_memory();
+  stan::math::autodiff_memory_size high_water_mark
+      = stan::math::memory_high_water_mark();
+  stan::math::autodiff_memory_size size{1 << 22, 1 << 18, 1 << 10};
+  EXPECT_TRUE(stan::math::reserve_memory(size));
+  // reserving memory does not change the high-water mark
+  stan::math::autodiff_memory_size reserved
+      = stan::math::memory_high_water_mark();
+  EXPECT_EQ(high_water_mark.arena_bytes, reserved.arena_bytes);
+  EXPECT_EQ(high_water_mark.var_stack_size, reserved.var_stack_size);
+  EXPECT_LE(1 << 18,
+            stan::math::ChainableStack::instance_->var_stack_.capacity());
+  EXPECT_EQ(1 << 22,
+            stan::math::ChainableStack::instance_->memalloc_.bytes_allocated());
+
+  var x = 1.5;
+  var y = x;
+  for (int i = 0; i < 1000; ++i) {
+    y = y * x;
+  }
+  y.grad();
+  EXPECT_FLOAT_EQ(1001 * std::pow(1.5, 1000), x.adj());
+  EXPECT_EQ(1 << 22,
+            stan::math::ChainableStack::instance_->memalloc_.bytes_allocated());
+
+  // the arena is in use, so it is not replaced
+  size.arena_bytes = 1 << 23;
+  EXPECT_FALSE(stan::math::reserve_memory(size));
+  stan::math::recover_memory();
+}
@@ -0,0 +1,307 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <vector>
+
+namespace {
+using stan::math::var;
+using stan::math::var_matrix;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using matrix_v = Eigen::Matrix<var, -1, -1>;
+using vector_v = Eigen::Matrix<var, -1, 1>;
+
+template <typename T1, typename T2>
+void expect_matrix_near(const T1& a, const T2& b, double tol = 1e-10) {
+  MatrixXd a_eval = a;
+  MatrixXd b_eval = b;
+  ASSERT_EQ(a_eval.rows(), b_eval.rows());
+  ASSERT_EQ(a_eval.cols(), b_eval.cols());
+  for (int i = 0; i < a_eval.size(); ++i) {
+    EXPECT_NEAR(a_eval(i), b_eval(i), tol);
+  }
+}
+
+MatrixXd test_matrix(int rows, int cols, double offset) {
+  MatrixXd x(rows, cols);
+  for (int i = 0; i < x.size(); ++i) {
+    x(i) = std::sin(offset + 0.7 * i);
+  }
+  return x;
+}
+
+// weights with distinct entries to reduce matrix results to scalars
+MatrixXd weights(int rows, int cols) { return test_matrix(rows, cols, 3.0); }
+
+var reduce(const matrix_v& x) {
+  return stan::math::sum(stan::math::elt_multiply(
+      x, weights(x.rows(), x.cols())));
+}
+
+template <typename M>
+var reduce(const var_matrix<M>& x) {
+  return reduce(matrix_v(stan::math::from_var_matrix(x)));
+}
+
+MatrixXd adj(const matrix_v& x) { return x.adj(); }
+
+template <typename T1, typename T2, typename = void>
+struct is_var_matrix_operand_pair : std::false_type {};
+
+template <typename T1, typename T2>
+struct is_var_matrix_operand_pair<
+    T1, T2, stan::require_all_var_matrix_or_eigen_t<T1, T2>>
+    : std::true_type {};
+}  // namespace
+
+TEST(AgradRevVarMatrix, require_all_var_matrix_or_eigen) {
+  using var_matrix_d = var_matrix<MatrixXd>;
+  EXPECT_TRUE((is_var_matrix_operand_pair<var_matrix_d, var_matrix_d>::value));
+  EXPECT_TRUE((is_var_matrix_operand_pair<var_matrix_d, MatrixXd>::value));
+  EXPECT_TRUE((is_var_matrix_operand_pair<MatrixXd, var_matrix_d>::value));
+  EXPECT_FALSE((is_var_matrix_operand_pair<var_matrix_d, matrix_v>::value));
+  EXPECT_FALSE((is_var_matrix_operand_pair<matrix_v, var_matrix_d>::value));
+  EXPECT_FALSE((is_var_matrix_operand_pair<var_matrix_d, double>::value));
+}
+
+TEST(AgradRevVarMatrix, construct_and_convert) {
+  MatrixXd x_val = test_matrix(3, 2, 0.0);
+  var_matrix<MatrixXd> x(x_val);
+  expect_matrix_near(x.val(), x_val);
+  expect_matrix_near(x.adj(), MatrixXd::Zero(3, 2));
+
+  matrix_v x_aos = stan::math::from_var_matrix(x);
+  expect_matrix_near(x_aos.val(), x_val);
+  var_matrix<MatrixXd> x_soa = stan::math::to_var_matrix(x_aos);
+  expect_matrix_near(x_soa.val(), x_val);
+
+  var lp = reduce(x_soa);
+  lp.grad();
+  expect_matrix_near(x.adj(), weights(3, 2));
+  expect_matrix_near(x_aos.adj(), weights(3, 2));
+
+  stan::math::set_zero_all_adjoints();
+  expect_matrix_near(x.adj(), MatrixXd::Zero(3, 2));
+  expect_matrix_near(x_soa.adj(), MatrixXd::Zero(3, 2));
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevVarMatrix, set_zero_all_adjoints_nested) {
+  var_matrix<MatrixXd> x(test_matrix(2, 2, 0.0));
+  x.adj().setConstant(2.0);
+  stan::math::start_nested();
+  var_matrix<MatrixXd> y(test_matrix(2, 2, 1.0));
+  y.adj().setConstant(3.0);
+  stan::math::set_zero_all_adjoints_nested();
+  expect_matrix_near(x.adj(), MatrixXd::Constant(2, 2, 2.0));
+  expect_matrix_near(y.adj(), MatrixXd::Zero(2, 2));
+  stan::math::recover_memory_nested();
+  EXPECT_EQ(1, stan::math::ChainableStack::instance_->var_matrix_adj_stack_
+                   .size());
+  stan::math::set_zero_all_adjoints();
+  expect_matrix_near(x.adj(), MatrixXd::Zero(2, 2));
+  stan::math::recover_memory();
+  EXPECT_EQ(0, stan::math::ChainableStack::instance_->var_matrix_adj_stack_
+                   .size());
+}
+
+TEST(AgradRevVarMatrix, multiply) {
+  MatrixXd a_val = test_matrix(3, 4, 0.0);
+  MatrixXd b_val = test_matrix(4, 2, 1.0);
+
+  matrix_v a_aos = a_val;
+  matrix_v b_aos = b_val;
+  var lp_aos = reduce(stan::math::multiply(a_aos, b_aos));
+  double lp_aos_val = lp_aos.val();
+  lp_aos.grad();
+  MatrixXd a_adj = adj(a_aos);
+  MatrixXd b_adj = adj(b_aos);
+  stan::math::recover_memory();
+
+  var_matrix<MatrixXd> a(a_val);
+  var_matrix<MatrixXd> b(b_val);
+  var_matrix<MatrixXd> ab = stan::math::multiply(a, b);
+  expect_matrix_near(ab.val(), a_val * b_val);
+  var lp = reduce(ab);
+  EXPECT_NEAR(lp_aos_val, lp.val(), 1e-10);
+  lp.grad();
+  expect_matrix_near(a.adj(), a_adj);
+  expect_matrix_near(b.adj(), b_adj);
+  stan::math::recover_memory();
+
+  var_matrix<MatrixXd> a2(a_val);
+  reduce(stan::math::multiply(a2, b_val)).grad();
+  expect_matrix_near(a2.adj(), a_adj);
+  stan::math::recover_memory();
+
+  var_matrix<MatrixXd> b2(b_val);
+  reduce(stan::math::multiply(a_val, b2)).grad();
+  expect_matrix_near(b2.adj(), b_adj);
+  stan::math::recover_memory();
+
+  var_matrix<VectorXd> v(VectorXd(b_val.col(0)));
+  var_matrix<VectorXd> av = stan::math::multiply(a_val, v);
+  expect_matrix_near(av.val(), a_val * b_val.col(0));
+  stan::math::recover_memory();
+
+  EXPECT_THROW(stan::math::multiply(var_matrix<MatrixXd>(a_val), a_val),
+               std::invalid_argument);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevVarMatrix, add_subtract) {
+  MatrixXd a_val = test_matrix(3, 2, 0.0);
+  MatrixXd b_val = test_matrix(3, 2, 1.0);
+
+  var_matrix<MatrixXd> a(a_val);
+  var_matrix<MatrixXd> b(b_val);
+  var_matrix<MatrixXd> sum = stan::math::add(a, b);
+  var_matrix<MatrixXd> diff = stan::math::subtract(a, b_val);
+  var_matrix<MatrixXd> diff2 = stan::math::subtract(a_val, b);
+  expect_matrix_near(sum.val(), a_val + b_val);
+  expect_matrix_near(diff.val(), a_val - b_val);
+  expect_matrix_near(diff2.val(), a_val - b_val);
+
+  var lp = reduce(sum) + 2 * reduce(diff) + 3 * reduce(diff2);
+  lp.grad();
+  expect_matrix_near(a.adj(), 3 * weights(3, 2));
+  expect_matrix_near(b.adj(), -2 * weights(3, 2));
+
+  EXPECT_THROW(stan::math::add(a, MatrixXd(2, 2)), std::invalid_argument);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevVarMatrix, dot_product) {
+  VectorXd a_val = test_matrix(5, 1, 0.0);
+  VectorXd b_val = test_matrix(5, 1, 1.0);
+
+  var_matrix<VectorXd> a(a_val);
+  var_matrix<VectorXd> b(b_val);
+  var ab = stan::math::dot_product(a, b);
+  var ab2 = stan::math::dot_product(a, b_val);
+  EXPECT_FLOAT_EQ(a_val.dot(b_val), ab.val());
+  EXPECT_FLOAT_EQ(a_val.dot(b_val), ab2.val());
+  (ab + 2 * ab2).grad();
+  expect_matrix_near(a.adj(), 3 * b_val);
+  expect_matrix_near(b.adj(), a_val);
+
+  EXPECT_THROW(stan::math::dot_product(a, VectorXd(3)), std::invalid_argument);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevVarMatrix, cholesky_decompose) {
+  for (int N : std::vector<int>{1, 5, 40}) {
+    MatrixXd X = test_matrix(N, N, 0.5);
+    MatrixXd A_val = X * X.transpose() + N * MatrixXd::Identity(N, N);
+
+    matrix_v A_aos = A_val;
+    var lp_aos = reduce(stan::math::cholesky_decompose(A_aos));
+    double lp_aos_val = lp_aos.val();
+    lp_aos.grad();
+    MatrixXd A_adj = adj(A_aos);
+    stan::math::recover_memory();
+
+    var_matrix<MatrixXd> A(A_val);
+    var_matrix<MatrixXd> L = stan::math::cholesky_decompose(A);
+    var lp = reduce(L);
+    EXPECT_NEAR(lp_aos_val, lp.val(), 1e-10);
+    lp.grad();
+    expect_matrix_near(A.adj(), A_adj, 1e-8);
+    stan::math::recover_memory();
+  }
+
+  MatrixXd not_pd(2, 2);
+  not_pd << 1, 2, 2, 1;
+  EXPECT_THROW(stan::math::cholesky_decompose(var_matrix<MatrixXd>(not_pd)),
+               std::domain_error);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevVarMatrix, normal_lpdf) {
+  VectorXd y_val = test_matrix(6, 1, 0.0);
+
+  vector_v y_aos = y_val;
+  var mu_aos = 0.3;
+  var sigma_aos = 1.7;
+  var lp_aos = stan::math::normal_lpdf(y_aos, mu_aos, sigma_aos);
+  double lp_aos_val = lp_aos.val();
+  lp_aos.grad();
+  VectorXd y_adj = y_aos.adj();
+  double mu_adj = mu_aos.adj();
+  double sigma_adj = sigma_aos.adj();
+  stan::math::recover_memory();
+
+  var_matrix<VectorXd> y(y_val);
+  var mu = 0.3;
+  var sigma = 1.7;
+  var lp = stan::math::normal_lpdf(y, mu, sigma);
+  EXPECT_FLOAT_EQ(lp_aos_val, lp.val());
+  lp.grad();
+  expect_matrix_near(y.adj(), y_adj);
+  EXPECT_FLOAT_EQ(mu_adj, mu.adj());
+  EXPECT_FLOAT_EQ(sigma_adj, sigma.adj());
+  stan::math::recover_memory();
+
+  var_matrix<VectorXd> y2(y_val);
+  var lp_propto = stan::math::normal_lpdf<true>(y2, 0.3, 1.7);
+  var lp_full = stan::math::normal_lpdf<false>(y2, 0.3, 1.7);
+  EXPECT_FLOAT_EQ(
+      lp_full.val() - lp_propto.val(),
+      6 * (stan::math::NEG_LOG_SQRT_TWO_PI - std::log(1.7)));
+
+  EXPECT_THROW(stan::math::normal_lpdf(y2, 0.3, -1.0), std::domain_error);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevVarMatrix, normal_lpdf_vector_parameters) {
+  MatrixXd y_val = test_matrix(3, 2, 0.0);
+  VectorXd mu_val = test_matrix(6, 1, 1.0);
+  VectorXd sigma_val = (test_matrix(6, 1, 2.0).array() + 1.5).matrix();
+
+  matrix_v y_aos = y_val;
+  vector_v mu_aos = mu_val;
+  vector_v sigma_aos = sigma_val;
+  var lp_aos = stan::math::normal_lpdf(stan::math::to_vector(y_aos), mu_aos,
+                                       sigma_aos);
+  double lp_aos_val = lp_aos.val();
+  lp_aos.grad();
+  MatrixXd y_adj = y_aos.adj();
+  VectorXd mu_adj = mu_aos.adj();
+  VectorXd sigma_adj = sigma_aos.adj();
+  stan::math::recover_memory();
+
+  var_matrix<MatrixXd> y(y_val);
+  var_matrix<VectorXd> mu(mu_val);
+  var_matrix<VectorXd> sigma(sigma_val);
+  var lp = stan::math::normal_lpdf(y, mu, sigma);
+  EXPECT_FLOAT_EQ(lp_aos_val, lp.val());
+  lp.grad();
+  expect_matrix_near(y.adj(), y_adj);
+  expect_matrix_near(mu.adj(), mu_adj);
+  expect_matrix_near(sigma.adj(), sigma_adj);
+  stan::math::recover_memory();
+
+  // arithmetic outcomes and scales, with a scalar outcome broadcast
+  vector_v mu2_aos = mu_val;
+  var lp2_aos = stan::math::normal_lpdf(0.5, mu2_aos, sigma_val);
+  double lp2_aos_val = lp2_aos.val();
+  lp2_aos.grad();
+  VectorXd mu2_adj = mu2_aos.adj();
+  stan::math::recover_memory();
+
+  var_matrix<VectorXd> mu2(mu_val);
+  var lp2 = stan::math::normal_lpdf(0.5, mu2, sigma_val);
+  EXPECT_FLOAT_EQ(lp2_aos_val, lp2.val());
+  lp2.grad();
+  expect_matrix_near(mu2.adj(), mu2_adj);
+  stan::math::recover_memory();
+
+  var_matrix<VectorXd> y3(mu_val);
+  EXPECT_THROW(stan::math::normal_lpdf(y3, VectorXd::Zero(5), 1.0),
+               std::invalid_argument);
+  VectorXd bad_sigma = sigma_val;
+  bad_sigma(2) = 0;
+  EXPECT_THROW(stan::math::normal_lpdf(y3, 0.0, bad_sigma),
+               std::domain_error);
+  stan::math::recover_memory();
+}
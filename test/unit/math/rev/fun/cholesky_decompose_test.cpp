@@ -0,0 +1,59 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+// weighted sum of the lower triangular entries of the Cholesky factor
+// of the lower triangular part of A, computed without autodiff
+double weighted_chol_sum(const Eigen::MatrixXd& A, const Eigen::MatrixXd& w) {
+  Eigen::MatrixXd L = A.llt().matrixL();
+  return L.cwiseProduct(w).sum();
+}
+
+void test_cholesky_gradient(int N) {
+  using stan::math::var;
+  Eigen::MatrixXd X(N, N);
+  Eigen::MatrixXd w(N, N);
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < N; ++j) {
+      X(i, j) = std::sin(i + 2.0 * j);
+      w(i, j) = std::cos(3.0 * i - j);
+    }
+  }
+  Eigen::MatrixXd A_d = X * X.transpose()
+                        + N * Eigen::MatrixXd::Identity(N, N);
+  w.triangularView<Eigen::StrictlyUpper>().setZero();
+
+  Eigen::Matrix<var, -1, -1> A = A_d;
+  Eigen::Matrix<var, -1, -1> L = stan::math::cholesky_decompose(A);
+  var f = stan::math::sum(stan::math::elt_multiply(L, w));
+  EXPECT_FLOAT_EQ(weighted_chol_sum(A_d, w), f.val());
+  f.grad();
+
+  const double eps = 1e-6;
+  for (int j = 0; j < N; j += 7) {
+    for (int i = j; i < N; i += 5) {
+      Eigen::MatrixXd A_p = A_d;
+      Eigen::MatrixXd A_m = A_d;
+      A_p(i, j) += eps;
+      A_m(i, j) -= eps;
+      double fd = (weighted_chol_sum(A_p, w) - weighted_chol_sum(A_m, w))
+                  / (2 * eps);
+      EXPECT_NEAR(fd, A(i, j).adj(), 1e-5) << i << ", " << j;
+    }
+  }
+  stan::math::recover_memory();
+}
+}  // namespace
+
+TEST(AgradRevMatrix, cholesky_decompose_scalar_gradient) {
+  test_cholesky_gradient(20);
+}
+
+TEST(AgradRevMatrix, cholesky_decompose_block_gradient) {
+  test_cholesky_gradient(70);
+}
+
+TEST(AgradRevMatrix, cholesky_decompose_many_blocks_gradient) {
+  test_cholesky_gradient(300);
+}
@@ -0,0 +1,131 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/math/rev/util.hpp>
+#include <gtest/gtest.h>
+
+TEST(AgradRevMatrix, matrix_exp_multiply_large) {
+  using stan::math::matrix_d;
+  using stan::math::matrix_v;
+  using stan::math::var;
+  const int N = 12;
+  const int M = 2;
+
+  // rate matrix of a linear compartment model
+  matrix_d A_d = matrix_d::Zero(N, N);
+  for (int i = 0; i < N - 1; ++i) {
+    A_d(i + 1, i) = 0.3 + 0.05 * i;
+    A_d(i, i) = -A_d(i + 1, i) - 0.1;
+  }
+  A_d(N - 1, N - 1) = -0.2;
+  matrix_d B_d(N, M);
+  for (int i = 0; i < N; ++i) {
+    B_d(i, 0) = 1.0 / (i + 1);
+    B_d(i, 1) = std::cos(i);
+  }
+
+  // gradients of the same sum through exp(A) * B and through the action
+  auto grads = [&](bool action) {
+    matrix_v A = A_d;
+    matrix_v B = B_d;
+    const matrix_v res = action ? stan::math::matrix_exp_multiply(A, B)
+                                : stan::math::multiply(
+                                      stan::math::matrix_exp(A), B);
+    test::check_varis_on_stack(res);
+    var lp = 0;
+    for (int i = 0; i < N; ++i) {
+      lp += (i + 1) * res(i, 0) - res(i, 1);
+    }
+    lp.grad();
+    std::vector<double> g{lp.val()};
+    for (int i = 0; i < A.size(); ++i) {
+      g.push_back(A(i).adj());
+    }
+    for (int i = 0; i < B.size(); ++i) {
+      g.push_back(B(i).adj());
+    }
+    stan::math::recover_memory();
+    return g;
+  };
+
+  const std::vector<double> g_exp = grads(false);
+  const std::vector<double> g_action = grads(true);
+  for (size_t i = 0; i < g_exp.size(); ++i) {
+    EXPECT_NEAR(g_exp[i], g_action[i], 1e-9);
+  }
+}
+
+TEST(AgradRevMatrix, matrix_exp_multiply_data_A) {
+  using stan::math::matrix_d;
+  using stan::math::matrix_v;
+  using stan::math::var;
+  matrix_d A(3, 3);
+  A << -1.0, 0.2, 0.0, 0.5, -0.7, 0.1, 0.0, 0.3, -0.4;
+  matrix_d B_d(3, 1);
+  B_d << 1.0, 2.0, -1.0;
+  matrix_v B = B_d;
+
+  var lp = stan::math::matrix_exp_multiply(A, B).sum();
+  lp.grad();
+
+  // the adjoint of B is exp(A)' times the adjoint of the result
+  const Eigen::VectorXd expected
+      = stan::math::matrix_exp(A).transpose() * Eigen::VectorXd::Ones(3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_FLOAT_EQ(expected(i), B(i).adj());
+  }
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevMatrix, matrix_exp_multiply_large_magnitudes) {
+  using stan::math::matrix_d;
+  using stan::math::matrix_v;
+  using stan::math::var;
+  const int N = 5;
+  const int M = 3;
+  matrix_d A_d(N, N);
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < N; ++j) {
+      A_d(i, j) = std::sin(i + 2.0 * j);
+    }
+  }
+
+  // large values of B and large adjoints of the result, and B = 0 for
+  // which the adjoint of A is zero
+  for (double B_scale : {1e8, 0.0}) {
+    matrix_d B_d(N, M);
+    for (int i = 0; i < B_d.size(); ++i) {
+      B_d(i) = B_scale * std::cos(3.0 * i);
+    }
+    auto grads = [&](bool action) {
+      matrix_v A = A_d;
+      matrix_v B = B_d;
+      const matrix_v res = action ? stan::math::matrix_exp_multiply(A, B)
+                                  : stan::math::multiply(
+                                        stan::math::matrix_exp(A), B);
+      var lp = 0;
+      for (int i = 0; i < res.size(); ++i) {
+        lp += 1e6 * (i + 1) * res(i);
+      }
+      lp.grad();
+      std::vector<double> g;
+      for (int i = 0; i < A.size(); ++i) {
+        g.push_back(A(i).adj());
+      }
+      for (int i = 0; i < B.size(); ++i) {
+        g.push_back(B(i).adj());
+      }
+      stan::math::recover_memory();
+      return g;
+    };
+
+    const std::vector<double> g_exp = grads(false);
+    const std::vector<double> g_action = grads(true);
+    double g_max = 0;
+    for (double g : g_exp) {
+      g_max = std::max(g_max, std::abs(g));
+    }
+    EXPECT_GT(g_max, 0);
+    for (size_t i = 0; i < g_exp.size(); ++i) {
+      EXPECT_NEAR(g_exp[i], g_action[i], 1e-10 * g_max);
+    }
+  }
+}
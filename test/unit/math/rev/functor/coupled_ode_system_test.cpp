@@ -471,3 +471,100 @@ TEST_F(StanAgradRevOde, memory_recovery_exception_vv) {
     EXPECT_TRUE(stan::math::empty_nested());
   }
 }
+
+namespace {
+struct nonlinear_ode_fun {
+  template <typename T0, typename T1, typename T2>
+  inline std::vector<stan::return_type_t<T1, T2>> operator()(
+      const T0& t_in, const std::vector<T1>& y, const std::vector<T2>& theta,
+      const std::vector<double>& x, const std::vector<int>& x_int,
+      std::ostream* msgs) const {
+    using stan::math::exp;
+    using stan::math::sin;
+    std::vector<stan::return_type_t<T1, T2>> res(3);
+    res[0] = -theta[0] * y[0] * y[1] + sin(y[2]);
+    res[1] = theta[0] * y[0] * y[1] - theta[1] * y[1] * y[1];
+    res[2] = y[0] * exp(-theta[1] * y[2]);
+    return res;
+  }
+};
+}  // namespace
+
+TEST_F(StanAgradRevOde, coupled_ode_system_vv_finite_diff) {
+  using stan::math::coupled_ode_system;
+  using stan::math::var;
+  stan::math::nested_rev_autodiff nested;
+
+  const size_t N = 3;
+  const size_t M = 2;
+  const std::vector<double> y_d{0.8, 1.3, -0.4};
+  const std::vector<double> theta_d{0.7, 1.9};
+  nonlinear_ode_fun f;
+
+  // central differences of the RHS with respect to states and parameters
+  const double h = 1e-6;
+  Eigen::MatrixXd jacobian_y(N, N);
+  Eigen::MatrixXd jacobian_theta(N, M);
+  for (size_t j = 0; j < N; ++j) {
+    std::vector<double> y_plus = y_d;
+    std::vector<double> y_minus = y_d;
+    y_plus[j] += h;
+    y_minus[j] -= h;
+    const std::vector<double> f_plus = f(0.0, y_plus, theta_d, x, x_int, 0);
+    const std::vector<double> f_minus = f(0.0, y_minus, theta_d, x, x_int, 0);
+    for (size_t i = 0; i < N; ++i) {
+      jacobian_y(i, j) = (f_plus[i] - f_minus[i]) / (2 * h);
+    }
+  }
+  for (size_t j = 0; j < M; ++j) {
+    std::vector<double> theta_plus = theta_d;
+    std::vector<double> theta_minus = theta_d;
+    theta_plus[j] += h;
+    theta_minus[j] -= h;
+    const std::vector<double> f_plus = f(0.0, y_d, theta_plus, x, x_int, 0);
+    const std::vector<double> f_minus = f(0.0, y_d, theta_minus, x, x_int, 0);
+    for (size_t i = 0; i < N; ++i) {
+      jacobian_theta(i, j) = (f_plus[i] - f_minus[i]) / (2 * h);
+    }
+  }
+
+  // arbitrary sensitivities, stored column by column after the states
+  Eigen::MatrixXd S(N, N + M);
+  for (size_t i = 0; i < N; ++i) {
+    for (size_t j = 0; j < N + M; ++j) {
+      S(i, j) = std::cos(1.0 + i + 2.0 * j);
+    }
+  }
+  std::vector<double> z(y_d);
+  z.insert(z.end(), S.data(), S.data() + S.size());
+
+  // d/dt S = J_y S + [0, J_theta]
+  Eigen::MatrixXd dS_dt = jacobian_y * S;
+  dS_dt.rightCols(M) += jacobian_theta;
+
+  std::vector<var> y0_var(y_d.begin(), y_d.end());
+  std::vector<var> theta_var(theta_d.begin(), theta_d.end());
+  coupled_ode_system<nonlinear_ode_fun, var, var> system_vv(
+      f, y0_var, theta_var, x, x_int, &msgs);
+  std::vector<double> dz_dt(N + N * (N + M));
+  system_vv(z, dz_dt, 0.0);
+
+  const std::vector<double> dy_dt = f(0.0, y_d, theta_d, x, x_int, 0);
+  for (size_t i = 0; i < N; ++i) {
+    EXPECT_FLOAT_EQ(dy_dt[i], dz_dt[i]);
+  }
+  for (size_t k = 0; k < N * (N + M); ++k) {
+    EXPECT_NEAR(dS_dt(k), dz_dt[N + k], 1e-7);
+  }
+
+  // with data initial states only the parameter sensitivities remain
+  std::vector<double> z_dv(y_d);
+  z_dv.insert(z_dv.end(), S.data() + N * N, S.data() + S.size());
+  coupled_ode_system<nonlinear_ode_fun, double, var> system_dv(
+      f, y_d, theta_var, x, x_int, &msgs);
+  std::vector<double> dz_dt_dv(N + N * M);
+  system_dv(z_dv, dz_dt_dv, 0.0);
+  for (size_t k = 0; k < N * M; ++k) {
+    EXPECT_NEAR(dS_dt(N * N + k), dz_dt_dv[N + k], 1e-7);
+  }
+}
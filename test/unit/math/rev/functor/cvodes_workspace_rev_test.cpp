@@ -0,0 +1,70 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/math/prim/functor/harmonic_oscillator.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using harm_osc_ode_data_vv
+    = stan::math::cvodes_ode_data<harm_osc_ode_fun, stan::math::var,
+                                  stan::math::var>;
+using harm_osc_workspace_vv
+    = stan::math::cvodes_workspace<CV_BDF, harm_osc_ode_data_vv>;
+
+TEST(StanMathRevCvodesWorkspace, reuse_per_size) {
+  const void* mem = nullptr;
+  {
+    auto workspace = harm_osc_workspace_vv::get(2, 3, 1, 1);
+    mem = workspace->cvodes_mem_;
+
+    // a workspace in use is not handed out again
+    auto nested_workspace = harm_osc_workspace_vv::get(2, 3, 1, 1);
+    EXPECT_NE(mem, nested_workspace->cvodes_mem_);
+  }
+
+  EXPECT_EQ(mem, harm_osc_workspace_vv::get(2, 3, 1, 1)->cvodes_mem_);
+
+  auto workspace = harm_osc_workspace_vv::get(2, 1, 1, 1);
+  EXPECT_EQ(2, workspace->N_);
+  EXPECT_EQ(1, workspace->S_);
+}
+
+TEST(StanMathRevCvodesWorkspace, repeated_solves) {
+  using stan::math::var;
+  harm_osc_ode_fun harm_osc;
+
+  std::vector<double> ts;
+  for (int i = 0; i < 10; i++)
+    ts.push_back(0.5 * (i + 1));
+  std::vector<double> x;
+  std::vector<int> x_int;
+
+  auto solve = [&](double gamma, long int max_num_steps) {
+    std::vector<var> theta{gamma};
+    std::vector<var> y0{1.0, 0.5};
+    std::vector<std::vector<var>> y = stan::math::integrate_ode_bdf(
+        harm_osc, y0, 0.0, ts, theta, x, x_int, nullptr, 1e-10, 1e-10,
+        max_num_steps);
+    stan::math::grad(y.back()[0].vi_);
+    std::vector<double> res{y.back()[0].val(), y.back()[1].val(),
+                            theta[0].adj(), y0[0].adj(), y0[1].adj()};
+    stan::math::recover_memory();
+    return res;
+  };
+
+  const std::vector<double> res1 = solve(0.15, 1e8);
+
+  // solves of another size, another parameter and failing solves in
+  // between do not change the results
+  std::vector<double> theta_d{0.15};
+  std::vector<double> y0_d{1.0, 0.5};
+  stan::math::integrate_ode_bdf(harm_osc, y0_d, 0.0, ts, theta_d, x, x_int);
+  solve(0.5, 1e8);
+  EXPECT_THROW(solve(0.15, 1), std::runtime_error);
+  stan::math::recover_memory();
+
+  const std::vector<double> res2 = solve(0.15, 1e8);
+  for (size_t i = 0; i < res1.size(); ++i) {
+    EXPECT_FLOAT_EQ(res1[i], res2[i]);
+  }
+}
@@ -893,3 +893,92 @@ TEST(StanMath_integrate_1d_rev, TestWeibull) {
   EXPECT_FLOAT_EQ(1, 1 + g[0]);
   EXPECT_FLOAT_EQ(1, 1 + g[1]);
 }
+
+struct counted_gaussian {
+  int *calls_;
+  explicit counted_gaussian(int *calls) : calls_(calls) {}
+  template <typename T1, typename T2, typename T3>
+  inline stan::return_type_t<T1, T2, T3> operator()(
+      const T1 &x, const T2 &xc, const std::vector<T3> &theta,
+      const std::vector<double> &x_r, const std::vector<int> &x_i,
+      std::ostream *msgs) const {
+    ++*calls_;
+    stan::return_type_t<T1, T2, T3> s = 0;
+    for (size_t n = 0; n < theta.size(); ++n) {
+      s += theta[n] * pow(x, n);
+    }
+    return exp(-x * x) * s;
+  }
+};
+
+TEST(StanMath_integrate_1d_rev, gradient_single_pass) {
+  using stan::math::var;
+  const size_t N = 15;
+  std::vector<double> theta_d(N);
+  for (size_t n = 0; n < N; ++n) {
+    theta_d[n] = 1.0 / (n + 1);
+  }
+  int calls_double = 0;
+  double I_d = stan::math::integrate_1d(counted_gaussian(&calls_double), -1.0,
+                                        2.0, theta_d, {}, {}, msgs, 1e-8);
+
+  int calls_var = 0;
+  std::vector<var> theta = stan::math::to_var(theta_d);
+  var I = stan::math::integrate_1d(counted_gaussian(&calls_var), -1.0, 2.0,
+                                   theta, {}, {}, msgs, 1e-8);
+  EXPECT_FLOAT_EQ(I_d, I.val());
+  // each node is evaluated once for the integral and its whole gradient
+  EXPECT_LE(calls_var, 2 * calls_double);
+
+  I.grad();
+  boost::math::quadrature::tanh_sinh<double> integrator;
+  for (size_t n = 0; n < N; ++n) {
+    double dI = integrator.integrate(
+        [&](double x) { return std::exp(-x * x) * std::pow(x, n); }, -1.0,
+        2.0);
+    EXPECT_NEAR(dI, theta[n].adj(), 1e-7);
+  }
+  stan::math::recover_memory();
+}
+
+struct exp_plus_inv {
+  template <typename T1, typename T2, typename T3>
+  inline stan::return_type_t<T1, T2, T3> operator()(
+      const T1 &x, const T2 &xc, const std::vector<T3> &theta,
+      const std::vector<double> &x_r, const std::vector<int> &x_i,
+      std::ostream *msgs) const {
+    return theta[0] * exp(x) + theta[1] / x;
+  }
+};
+
+TEST(StanMath_integrate_1d_rev, tolerance_relative_to_largest_component) {
+  using stan::math::var;
+  // the integral is dominated by theta[0], its derivative with respect
+  // to theta[1] is small in comparison
+  const double a = 0.5;
+  const double b = 2.0;
+  const double dI_dtheta0 = std::exp(b) - std::exp(a);
+  const double dI_dtheta1 = std::log(b / a);
+  for (double tolerance : {1e-4, 1e-6, 1e-8}) {
+    std::vector<var> theta = {1e3, 1e-2};
+    var I = stan::math::integrate_1d(exp_plus_inv{}, a, b, theta, {}, {},
+                                     msgs, tolerance);
+    I.grad();
+    const double I_exact
+        = theta[0].val() * dI_dtheta0 + theta[1].val() * dI_dtheta1;
+    const double largest = std::abs(I_exact);
+    EXPECT_NEAR(I_exact, I.val(), tolerance * largest);
+    EXPECT_NEAR(dI_dtheta0, theta[0].adj(), tolerance * largest);
+    EXPECT_NEAR(dI_dtheta1, theta[1].adj(), tolerance * largest);
+    stan::math::recover_memory();
+  }
+}
+
+TEST(StanMath_integrate_1d_rev, gradient_of_f) {
+  std::vector<double> theta = {2.0, 3.0};
+  EXPECT_FLOAT_EQ(std::exp(1.5),
+                  stan::math::gradient_of_f(exp_plus_inv{}, 1.5, 0.0, theta,
+                                            {}, {}, 0, msgs));
+  EXPECT_FLOAT_EQ(1 / 1.5, stan::math::gradient_of_f(exp_plus_inv{}, 1.5, 0.0,
+                                                     theta, {}, {}, 1, msgs));
+}
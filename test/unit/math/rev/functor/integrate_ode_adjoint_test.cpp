@@ -0,0 +1,263 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/math/prim/functor/harmonic_oscillator.hpp>
+#include <test/unit/math/prim/functor/lorenz.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using stan::math::var;
+
+struct decay_ode_fun {
+  template <typename T0, typename T1, typename T2>
+  inline std::vector<stan::return_type_t<T1, T2>> operator()(
+      const T0& t_in, const std::vector<T1>& y_in,
+      const std::vector<T2>& theta, const std::vector<double>& x,
+      const std::vector<int>& x_int, std::ostream* msgs) const {
+    const size_t N = y_in.size();
+    std::vector<stan::return_type_t<T1, T2>> res(N);
+    for (size_t i = 0; i < N; ++i) {
+      res[i] = -theta[i] * y_in[i];
+      if (i > 0) {
+        res[i] += theta[i - 1] * y_in[i - 1];
+      }
+    }
+    return res;
+  }
+};
+
+/*
+ * Compares the value and the gradient of a scalar function of all
+ * outputs of integrate_ode_adjoint with the forward sensitivity
+ * solution of integrate_ode_bdf.
+ */
+template <typename F, typename T_y0, typename T_theta, typename T_t0,
+          typename T_ts>
+void test_adjoint_vs_forward(const F& f, const std::vector<double>& y0_d,
+                             double t0_d, const std::vector<double>& ts_d,
+                             const std::vector<double>& theta_d,
+                             const std::vector<double>& x,
+                             const std::vector<int>& x_int, double tol) {
+  using stan::math::promote_scalar;
+
+  std::vector<double> grad_bdf;
+  std::vector<double> grad_adjoint;
+  std::vector<double> vals_bdf;
+  std::vector<double> vals_adjoint;
+
+  for (int method = 0; method < 2; ++method) {
+    std::vector<T_y0> y0 = promote_scalar<T_y0>(y0_d);
+    std::vector<T_theta> theta = promote_scalar<T_theta>(theta_d);
+    T_t0 t0 = t0_d;
+    std::vector<T_ts> ts = promote_scalar<T_ts>(ts_d);
+
+    std::vector<std::vector<var>> y
+        = method == 0
+              ? stan::math::integrate_ode_bdf(f, y0, t0, ts, theta, x, x_int,
+                                              nullptr, 1e-10, 1e-10, 1e8)
+              : stan::math::integrate_ode_adjoint(f, y0, t0, ts, theta, x,
+                                                  x_int, nullptr, 1e-10, 1e-10,
+                                                  1e8, 25);
+
+    // weighted sum of all outputs such that all output adjoints are
+    // non-zero and distinct
+    var lp = 0;
+    std::vector<double>& vals = method == 0 ? vals_bdf : vals_adjoint;
+    for (size_t n = 0; n < y.size(); ++n) {
+      for (size_t i = 0; i < y[n].size(); ++i) {
+        lp += (1.0 + 0.1 * n - 0.3 * i) * y[n][i];
+        vals.push_back(y[n][i].val());
+      }
+    }
+
+    std::vector<var> operands;
+    for (auto& y0_i : y0) {
+      if (stan::is_var<T_y0>::value) {
+        operands.push_back(y0_i);
+      }
+    }
+    for (auto& theta_i : theta) {
+      if (stan::is_var<T_theta>::value) {
+        operands.push_back(theta_i);
+      }
+    }
+    if (stan::is_var<T_t0>::value) {
+      operands.push_back(t0);
+    }
+    for (auto& ts_i : ts) {
+      if (stan::is_var<T_ts>::value) {
+        operands.push_back(ts_i);
+      }
+    }
+    lp.grad(operands, method == 0 ? grad_bdf : grad_adjoint);
+    stan::math::recover_memory();
+  }
+
+  ASSERT_EQ(vals_bdf.size(), vals_adjoint.size());
+  for (size_t i = 0; i < vals_bdf.size(); ++i) {
+    EXPECT_NEAR(vals_bdf[i], vals_adjoint[i], 1e-8);
+  }
+  ASSERT_EQ(grad_bdf.size(), grad_adjoint.size());
+  for (size_t i = 0; i < grad_bdf.size(); ++i) {
+    EXPECT_NEAR(grad_bdf[i], grad_adjoint[i], tol) << "operand " << i;
+  }
+}
+
+TEST(StanMathRevIntegrateOdeAdjoint, harmonic_oscillator) {
+  harm_osc_ode_fun f;
+  std::vector<double> y0{1.0, 0.5};
+  std::vector<double> theta{0.15};
+  std::vector<double> ts;
+  for (int i = 0; i < 20; i++) {
+    ts.push_back(0.5 * (i + 1));
+  }
+  std::vector<double> x;
+  std::vector<int> x_int;
+
+  test_adjoint_vs_forward<harm_osc_ode_fun, double, var, double, double>(
+      f, y0, 0.0, ts, theta, x, x_int, 1e-6);
+  test_adjoint_vs_forward<harm_osc_ode_fun, var, double, double, double>(
+      f, y0, 0.0, ts, theta, x, x_int, 1e-6);
+  test_adjoint_vs_forward<harm_osc_ode_fun, var, var, double, double>(
+      f, y0, 0.0, ts, theta, x, x_int, 1e-6);
+  test_adjoint_vs_forward<harm_osc_ode_fun, var, var, double, var>(
+      f, y0, 0.0, ts, theta, x, x_int, 1e-6);
+}
+
+TEST(StanMathRevIntegrateOdeAdjoint, lorenz) {
+  lorenz_ode_fun f;
+  std::vector<double> y0{10.0, 1.0, 1.0};
+  std::vector<double> theta{10.0, 28.0, 8.0 / 3.0};
+  std::vector<double> ts;
+  for (int i = 0; i < 10; i++) {
+    ts.push_back(0.05 * (i + 1));
+  }
+  std::vector<double> x;
+  std::vector<int> x_int;
+
+  test_adjoint_vs_forward<lorenz_ode_fun, var, var, double, double>(
+      f, y0, 0.0, ts, theta, x, x_int, 1e-4);
+}
+
+TEST(StanMathRevIntegrateOdeAdjoint, many_parameters) {
+  decay_ode_fun f;
+  const size_t N = 8;
+  std::vector<double> y0(N, 0.0);
+  y0[0] = 10.0;
+  std::vector<double> theta(N);
+  for (size_t i = 0; i < N; ++i) {
+    theta[i] = 0.5 + 0.1 * i;
+  }
+  std::vector<double> ts{0.5, 1.0, 2.0, 5.0};
+  std::vector<double> x;
+  std::vector<int> x_int;
+
+  test_adjoint_vs_forward<decay_ode_fun, double, var, double, double>(
+      f, y0, 0.0, ts, theta, x, x_int, 1e-6);
+}
+
+TEST(StanMathRevIntegrateOdeAdjoint, initial_time) {
+  harm_osc_ode_fun f;
+  std::vector<double> y0{1.0, 0.5};
+  std::vector<double> theta{0.15};
+  std::vector<double> ts{1.0, 2.0, 3.0};
+  std::vector<double> x;
+  std::vector<int> x_int;
+
+  var t0 = 0.2;
+  std::vector<var> y0_v(y0.begin(), y0.end());
+  std::vector<std::vector<var>> y = stan::math::integrate_ode_adjoint(
+      f, y0_v, t0, ts, theta, x, x_int);
+  y[2][0].grad();
+  const double t0_adj = t0.adj();
+  stan::math::recover_memory();
+
+  // shifting the initial time is equivalent to shifting all output
+  // times in the opposite direction for an autonomous system
+  std::vector<var> ts_v(ts.begin(), ts.end());
+  std::vector<std::vector<var>> y_ts = stan::math::integrate_ode_adjoint(
+      f, y0, 0.2, ts_v, theta, x, x_int);
+  y_ts[2][0].grad();
+  EXPECT_NEAR(-ts_v[2].adj(), t0_adj, 1e-7);
+  stan::math::recover_memory();
+}
+
+TEST(StanMathRevIntegrateOdeAdjoint, jacobian) {
+  harm_osc_ode_fun f;
+  std::vector<var> y0{1.0, 0.5};
+  std::vector<var> theta{0.15};
+  std::vector<double> ts{1.0, 2.0, 3.0};
+  std::vector<double> x;
+  std::vector<int> x_int;
+
+  std::vector<std::vector<var>> y_adj = stan::math::integrate_ode_adjoint(
+      f, y0, 0.0, ts, theta, x, x_int, nullptr, 1e-10, 1e-10, 1e8, 1);
+  std::vector<std::vector<var>> y_bdf
+      = stan::math::integrate_ode_bdf(f, y0, 0.0, ts, theta, x, x_int);
+
+  std::vector<var> operands{y0[0], y0[1], theta[0]};
+  for (size_t n = 0; n < ts.size(); ++n) {
+    for (size_t i = 0; i < 2; ++i) {
+      std::vector<double> g_adj;
+      std::vector<double> g_bdf;
+      stan::math::set_zero_all_adjoints();
+      y_adj[n][i].grad(operands, g_adj);
+      stan::math::set_zero_all_adjoints();
+      y_bdf[n][i].grad(operands, g_bdf);
+      for (size_t k = 0; k < operands.size(); ++k) {
+        EXPECT_NEAR(g_bdf[k], g_adj[k], 1e-6);
+      }
+    }
+  }
+  stan::math::recover_memory();
+}
+
+TEST(StanMathRevIntegrateOdeAdjoint, data_only) {
+  harm_osc_ode_fun f;
+  std::vector<double> y0{1.0, 0.5};
+  std::vector<double> theta{0.15};
+  std::vector<double> ts{1.0, 2.0};
+  std::vector<double> x;
+  std::vector<int> x_int;
+
+  std::vector<std::vector<double>> y_adj = stan::math::integrate_ode_adjoint(
+      f, y0, 0.0, ts, theta, x, x_int);
+  std::vector<std::vector<double>> y_bdf
+      = stan::math::integrate_ode_bdf(f, y0, 0.0, ts, theta, x, x_int);
+  for (size_t n = 0; n < ts.size(); ++n) {
+    for (size_t i = 0; i < 2; ++i) {
+      EXPECT_FLOAT_EQ(y_bdf[n][i], y_adj[n][i]);
+    }
+  }
+}
+
+TEST(StanMathRevIntegrateOdeAdjoint, errors) {
+  harm_osc_ode_fun f;
+  std::vector<var> y0{1.0, 0.5};
+  std::vector<var> theta{0.15};
+  std::vector<double> ts{1.0, 2.0};
+  std::vector<double> ts_bad{2.0, 1.0};
+  std::vector<double> x;
+  std::vector<int> x_int;
+
+  EXPECT_THROW(
+      stan::math::integrate_ode_adjoint(f, y0, 0.0, ts_bad, theta, x, x_int),
+      std::domain_error);
+  EXPECT_THROW(
+      stan::math::integrate_ode_adjoint(f, y0, 1.5, ts, theta, x, x_int),
+      std::domain_error);
+  EXPECT_THROW(stan::math::integrate_ode_adjoint(f, y0, 0.0, ts, theta, x,
+                                                 x_int, nullptr, 1e-10, 1e-10,
+                                                 1e8, 0),
+               std::invalid_argument);
+  EXPECT_THROW(stan::math::integrate_ode_adjoint(f, y0, 0.0, ts, theta, x,
+                                                 x_int, nullptr, 1e-10, 1e-10,
+                                                 1e8, 100, 5),
+               std::invalid_argument);
+  std::vector<double> ts_long{100.0};
+  EXPECT_THROW(stan::math::integrate_ode_adjoint(f, y0, 0.0, ts_long, theta, x,
+                                                 x_int, nullptr, 1e-10, 1e-10,
+                                                 10),
+               std::runtime_error);
+  stan::math::recover_memory();
+}
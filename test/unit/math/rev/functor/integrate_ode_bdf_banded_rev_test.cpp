@@ -0,0 +1,154 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/util.hpp>
+#include <stdexcept>
+#include <vector>
+
+// discretized reaction-diffusion equation with a tridiagonal Jacobian
+struct reaction_diffusion_ode_fun {
+  template <typename T0, typename T1, typename T2>
+  inline std::vector<stan::return_type_t<T1, T2>> operator()(
+      const T0& t_in, const std::vector<T1>& y,
+      const std::vector<T2>& theta, const std::vector<double>& x,
+      const std::vector<int>& x_int, std::ostream* msgs) const {
+    const size_t N = y.size();
+    std::vector<stan::return_type_t<T1, T2>> dydt(N);
+    for (size_t i = 0; i < N; ++i) {
+      const T1 left = i == 0 ? T1(0) : y[i - 1];
+      const T1 right = i == N - 1 ? T1(0) : y[i + 1];
+      dydt[i] = theta[0] * (left - 2 * y[i] + right) - theta[1] * y[i] * y[i];
+    }
+    return dydt;
+  }
+};
+
+TEST(StanMathRevOdeBdfBanded, jacobian_states) {
+  using stan::math::cvodes_ode_data;
+  reaction_diffusion_ode_fun f;
+  const size_t N = 7;
+  std::vector<double> y0(N), theta{2.0, 0.5}, x;
+  std::vector<int> x_int;
+  for (size_t i = 0; i < N; ++i) {
+    y0[i] = 1.0 + 0.1 * i;
+  }
+  cvodes_ode_data<reaction_diffusion_ode_fun, double, double> ode_data(
+      f, y0, theta, x, x_int, nullptr);
+
+  N_Vector y = N_VMake_Serial(N, y0.data());
+  SUNMatrix dense = SUNDenseMatrix(N, N);
+  SUNMatrix band = SUNBandMatrix(N, 1, 1);
+  ode_data.cv_jacobian_states(0.5, y, nullptr, dense, &ode_data, nullptr,
+                              nullptr, nullptr);
+  ode_data.cv_jacobian_states(0.5, y, nullptr, band, &ode_data, nullptr,
+                              nullptr, nullptr);
+
+  for (size_t i = 0; i < N; ++i) {
+    for (size_t j = (i == 0 ? 0 : i - 1); j < std::min(N, i + 2); ++j) {
+      EXPECT_FLOAT_EQ(SM_ELEMENT_D(dense, i, j), SM_ELEMENT_B(band, i, j));
+    }
+  }
+
+  SUNMatDestroy(band);
+  SUNMatDestroy(dense);
+  N_VDestroy_Serial(y);
+}
+
+TEST(StanMathRevOdeBdfBanded, matches_dense) {
+  using stan::math::var;
+  reaction_diffusion_ode_fun f;
+  const size_t N = 30;
+  std::vector<double> ts{0.5, 1.0, 2.0}, x;
+  std::vector<int> x_int;
+
+  auto solve = [&](bool banded) {
+    std::vector<var> y0(N), theta{20.0, 0.5};
+    for (size_t i = 0; i < N; ++i) {
+      y0[i] = i < N / 2 ? 1.0 : 0.0;
+    }
+    std::vector<std::vector<var>> y
+        = banded ? stan::math::integrate_ode_bdf_banded(f, y0, 0.0, ts, theta,
+                                                         x, x_int, 1, 1)
+                 : stan::math::integrate_ode_bdf(f, y0, 0.0, ts, theta, x,
+                                                 x_int);
+    std::vector<double> res;
+    for (size_t i = 0; i < N; ++i) {
+      res.push_back(y.back()[i].val());
+    }
+    stan::math::grad(y.back()[N / 2].vi_);
+    res.push_back(theta[0].adj());
+    res.push_back(theta[1].adj());
+    for (size_t i = 0; i < N; ++i) {
+      res.push_back(y0[i].adj());
+    }
+    stan::math::recover_memory();
+    return res;
+  };
+
+  const std::vector<double> dense = solve(false);
+  const std::vector<double> banded = solve(true);
+  ASSERT_EQ(dense.size(), banded.size());
+  for (size_t i = 0; i < dense.size(); ++i) {
+    EXPECT_NEAR(dense[i], banded[i], 1e-7);
+  }
+}
+
+TEST(StanMathRevOdeBdfBanded, too_narrow_band_matches_dense) {
+  using stan::math::var;
+  reaction_diffusion_ode_fun f;
+  const size_t N = 20;
+  std::vector<double> ts{0.5, 1.0}, x;
+  std::vector<int> x_int;
+
+  // the Jacobian is tridiagonal, the banded solve drops its lower
+  // diagonal, such that the Newton iteration uses a wrong Jacobian
+  auto solve = [&](bool banded) {
+    std::vector<var> y0(N), theta{5.0, 0.5};
+    for (size_t i = 0; i < N; ++i) {
+      y0[i] = i < N / 2 ? 1.0 : 0.0;
+    }
+    std::vector<std::vector<var>> y
+        = banded ? stan::math::integrate_ode_bdf_banded(f, y0, 0.0, ts, theta,
+                                                         x, x_int, 0, 1)
+                 : stan::math::integrate_ode_bdf(f, y0, 0.0, ts, theta, x,
+                                                 x_int);
+    std::vector<double> res;
+    for (size_t i = 0; i < N; ++i) {
+      res.push_back(y.back()[i].val());
+    }
+    stan::math::grad(y.back()[N / 2].vi_);
+    res.push_back(theta[0].adj());
+    res.push_back(theta[1].adj());
+    stan::math::recover_memory();
+    return res;
+  };
+
+  const std::vector<double> dense = solve(false);
+  const std::vector<double> banded = solve(true);
+  ASSERT_EQ(dense.size(), banded.size());
+  for (size_t i = 0; i < dense.size(); ++i) {
+    EXPECT_NEAR(dense[i], banded[i], 1e-6);
+  }
+}
+
+TEST(StanMathRevOdeBdfBanded, error_conditions) {
+  reaction_diffusion_ode_fun f;
+  std::vector<double> y0{1.0, 0.5, 0.0}, theta{1.0, 0.5}, ts{1.0}, x;
+  std::vector<int> x_int;
+
+  EXPECT_THROW_MSG(stan::math::integrate_ode_bdf_banded(f, y0, 0.0, ts, theta,
+                                                        x, x_int, -1, 1),
+                   std::domain_error, "lower_bandwidth");
+  EXPECT_THROW_MSG(stan::math::integrate_ode_bdf_banded(f, y0, 0.0, ts, theta,
+                                                        x, x_int, 1, -1),
+                   std::domain_error, "upper_bandwidth");
+
+  // bandwidths beyond the size of the system use the dense solver
+  std::vector<std::vector<double>> y_dense
+      = stan::math::integrate_ode_bdf(f, y0, 0.0, ts, theta, x, x_int);
+  std::vector<std::vector<double>> y_wide
+      = stan::math::integrate_ode_bdf_banded(f, y0, 0.0, ts, theta, x, x_int,
+                                             5, 5);
+  for (size_t i = 0; i < y0.size(); ++i) {
+    EXPECT_FLOAT_EQ(y_dense[0][i], y_wide[0][i]);
+  }
+}
@@ -163,3 +163,43 @@ TEST_F(map_rect, concurrent_eval_ok_vv) {
     }
   }
 }
+
+TEST_F(map_rect, concurrent_grainsize_vv) {
+  stan::math::vector_v shared_params_v = stan::math::to_var(shared_params_d);
+  std::vector<stan::math::vector_v> job_params_v;
+
+  for (std::size_t i = 0; i < N; i++)
+    job_params_v.push_back(stan::math::to_var(job_params_d[i]));
+
+  stan::math::vector_v res1 = stan::math::map_rect<0, hard_work>(
+      shared_params_v, job_params_v, x_r, x_i);
+
+  for (int grainsize : {3, 7, static_cast<int>(N), 2 * static_cast<int>(N)}) {
+    stan::math::vector_v res2 = stan::math::map_rect<0, hard_work>(
+        shared_params_v, job_params_v, x_r, x_i, nullptr, grainsize);
+    ASSERT_EQ(res1.size(), res2.size());
+
+    for (int j = 0; j < res1.size(); j++) {
+      EXPECT_FLOAT_EQ(res1(j).val(), res2(j).val());
+
+      stan::math::set_zero_all_adjoints();
+      res1(j).grad();
+      std::vector<double> adj1;
+      adj1.push_back(shared_params_v(0).adj());
+      adj1.push_back(shared_params_v(1).adj());
+      for (std::size_t k = 0; k < N; k++) {
+        adj1.push_back(job_params_v[k](0).adj());
+        adj1.push_back(job_params_v[k](1).adj());
+      }
+
+      stan::math::set_zero_all_adjoints();
+      res2(j).grad();
+      EXPECT_FLOAT_EQ(shared_params_v(0).adj(), adj1[0]);
+      EXPECT_FLOAT_EQ(shared_params_v(1).adj(), adj1[1]);
+      for (std::size_t k = 0; k < N; k++) {
+        EXPECT_FLOAT_EQ(job_params_v[k](0).adj(), adj1[2 + 2 * k]);
+        EXPECT_FLOAT_EQ(job_params_v[k](1).adj(), adj1[3 + 2 * k]);
+      }
+    }
+  }
+}
@@ -0,0 +1,144 @@
+// these tests can only be compiled and executed with availability of
+// MPI
+#ifdef STAN_MPI
+
+// the tests here check map_rect with dynamic scheduling of the jobs
+#ifndef STAN_MPI_DYNAMIC
+#define STAN_MPI_DYNAMIC
+#endif
+
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/util.hpp>
+
+#include <test/unit/math/prim/functor/hard_work.hpp>
+#include <test/unit/math/prim/functor/faulty_functor.hpp>
+
+#include <iostream>
+#include <vector>
+
+STAN_REGISTER_MAP_RECT(0, hard_work)
+STAN_REGISTER_MAP_RECT(1, faulty_functor)
+STAN_REGISTER_MAP_RECT(2, faulty_functor)
+
+struct MpiDynamicJob : public ::testing::Test {
+  std::vector<stan::math::vector_d> job_params_d;
+  stan::math::vector_v shared_params_v;
+  std::vector<stan::math::vector_v> job_params_v;
+  stan::math::vector_v shared_params_v2;
+  std::vector<stan::math::vector_v> job_params_v2;
+  const std::size_t N = 100;
+  std::vector<std::vector<double>> x_r
+      = std::vector<std::vector<double>>(N, std::vector<double>(1, 1.0));
+  std::vector<std::vector<int>> x_i
+      = std::vector<std::vector<int>>(N, std::vector<int>(1, 0));
+
+  virtual void SetUp() {
+    shared_params_v.resize(2);
+    shared_params_v << 2, 0;
+
+    shared_params_v2.resize(2);
+    shared_params_v2 << 2, 0;
+
+    for (std::size_t n = 0; n != N; ++n) {
+      x_r[n][0] = n % 7;
+      x_i[n][0] = n;
+      stan::math::vector_v job_v(2);
+      job_v << n + 1.0, n * n;
+      job_params_v.push_back(job_v);
+
+      job_params_d.push_back(stan::math::value_of(job_v));
+
+      stan::math::vector_v job_v2(2);
+      job_v2 << n + 1.0, n * n;
+      job_params_v2.push_back(job_v2);
+    }
+  }
+};
+
+TEST_F(MpiDynamicJob, hard_work_vv) {
+  // evaluate repeatedly to use the cached data
+  for (int iter = 0; iter < 3; ++iter) {
+    stan::math::vector_v result_mpi = stan::math::map_rect<0, hard_work>(
+        shared_params_v, job_params_v, x_r, x_i, 0);
+
+    stan::math::vector_v result_concurrent
+        = stan::math::internal::map_rect_concurrent<0, hard_work>(
+            shared_params_v2, job_params_v2, x_r, x_i, 0);
+
+    ASSERT_EQ(result_mpi.rows(), result_concurrent.rows());
+
+    for (int ij = 0; ij < result_mpi.rows(); ++ij) {
+      EXPECT_DOUBLE_EQ(result_mpi(ij).val(), result_concurrent(ij).val());
+
+      stan::math::set_zero_all_adjoints();
+      result_mpi(ij).grad();
+      std::vector<double> adj_mpi;
+      for (int k = 0; k < 2; ++k) {
+        adj_mpi.push_back(shared_params_v(k).adj());
+      }
+      for (std::size_t i = 0; i < N; ++i) {
+        for (int k = 0; k < 2; ++k) {
+          adj_mpi.push_back(job_params_v[i](k).adj());
+        }
+      }
+
+      stan::math::set_zero_all_adjoints();
+      result_concurrent(ij).grad();
+      for (int k = 0; k < 2; ++k) {
+        EXPECT_DOUBLE_EQ(adj_mpi[k], shared_params_v2(k).adj());
+      }
+      for (std::size_t i = 0; i < N; ++i) {
+        for (int k = 0; k < 2; ++k) {
+          EXPECT_DOUBLE_EQ(adj_mpi[2 + 2 * i + k], job_params_v2[i](k).adj());
+        }
+      }
+    }
+
+    shared_params_v(1) += 1.0;
+    shared_params_v2(1) += 1.0;
+  }
+}
+
+TEST_F(MpiDynamicJob, hard_work_dd) {
+  stan::math::vector_d shared_params_d = stan::math::value_of(shared_params_v);
+  stan::math::vector_d result_mpi = stan::math::map_rect<0, hard_work>(
+      shared_params_d, job_params_d, x_r, x_i, 0);
+
+  stan::math::vector_d result_concurrent
+      = stan::math::internal::map_rect_concurrent<0, hard_work>(
+          shared_params_d, job_params_d, x_r, x_i, 0);
+
+  ASSERT_EQ(result_mpi.rows(), result_concurrent.rows());
+  for (int ij = 0; ij < result_mpi.rows(); ++ij) {
+    EXPECT_DOUBLE_EQ(result_mpi(ij), result_concurrent(ij));
+  }
+}
+
+TEST_F(MpiDynamicJob, always_faulty_functor_vv) {
+  stan::math::vector_v result;
+
+  EXPECT_NO_THROW((result = stan::math::map_rect<1, faulty_functor>(
+                       shared_params_v, job_params_v, x_r, x_i)));
+
+  // faulty functor throws on theta(0) being -1.0, which is raised on
+  // the root once all jobs are done, whether on the first evaluation
+  // or later ones
+  job_params_v[N - 1](0) = -1;
+
+  EXPECT_THROW_MSG((result = stan::math::map_rect<1, faulty_functor>(
+                        shared_params_v, job_params_v, x_r, x_i)),
+                   std::domain_error, "Error during MPI evaluation.");
+
+  EXPECT_THROW_MSG((result = stan::math::map_rect<2, faulty_functor>(
+                        shared_params_v, job_params_v, x_r, x_i)),
+                   std::domain_error, "Error during MPI evaluation.");
+
+  // the cluster is usable after a failure
+  job_params_v[N - 1](0) = 1;
+  EXPECT_NO_THROW((result = stan::math::map_rect<2, faulty_functor>(
+                       shared_params_v, job_params_v, x_r, x_i)));
+  EXPECT_EQ(result.rows(), 2 * N);
+}
+
+#endif
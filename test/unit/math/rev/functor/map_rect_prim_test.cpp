@@ -94,3 +94,9 @@ TEST_F(map_rect, wrong_size_int_data_dd) {
                                                    job_params_d, x_r, x_i)),
                std::invalid_argument);
 }
+
+TEST_F(map_rect, grainsize_not_positive_dd) {
+  EXPECT_THROW((stan::math::map_rect<1, hard_work>(
+                   shared_params_d, job_params_d, x_r, x_i, nullptr, 0)),
+               std::domain_error);
+}
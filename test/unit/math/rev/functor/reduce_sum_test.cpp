@@ -0,0 +1,264 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+
+struct count_lpdf {
+  template <typename T>
+  inline T operator()(const std::vector<int>& sub_slice, std::size_t start,
+                      std::size_t end, std::ostream* msgs,
+                      const std::vector<T>& lambda,
+                      const std::vector<int>& idata) const {
+    return stan::math::poisson_lpmf(sub_slice, lambda[0]);
+  }
+};
+
+struct slice_normal_lpdf {
+  template <typename T1, typename T2, typename T3>
+  inline stan::return_type_t<T1, T2, T3> operator()(
+      const std::vector<T1>& sub_slice, std::size_t start, std::size_t end,
+      std::ostream* msgs, const T2& mu, const T3& sigma) const {
+    return stan::math::normal_lpdf(sub_slice, mu, sigma);
+  }
+};
+
+struct nested_slice_lpdf {
+  template <typename T1, typename T2, typename T3>
+  inline stan::return_type_t<T1, T2, T3> operator()(
+      const std::vector<Eigen::Matrix<T1, Eigen::Dynamic, 1>>& sub_slice,
+      std::size_t start, std::size_t end, std::ostream* msgs,
+      const Eigen::Matrix<T2, Eigen::Dynamic, 1>& mu,
+      const std::vector<T3>& sigma) const {
+    stan::return_type_t<T1, T2, T3> lp = 0;
+    for (std::size_t i = 0; i < sub_slice.size(); ++i) {
+      lp += stan::math::normal_lpdf(sub_slice[i], mu, sigma[start + i]);
+    }
+    return lp;
+  }
+};
+
+TEST(StanMathRev_reduce_sum, value) {
+  stan::math::init_threadpool_tbb();
+
+  double lambda_d = 10.0;
+  const std::size_t elems = 10000;
+  std::vector<int> data(elems);
+
+  for (std::size_t i = 0; i != elems; ++i) {
+    data[i] = i;
+  }
+
+  std::vector<int> idata;
+  std::vector<double> vlambda_d(1, lambda_d);
+
+  double poisson_lpdf = stan::math::reduce_sum<count_lpdf>(
+      data, 5, nullptr, vlambda_d, idata);
+
+  double poisson_lpdf_ref = stan::math::poisson_lpmf(data, lambda_d);
+
+  EXPECT_FLOAT_EQ(poisson_lpdf, poisson_lpdf_ref);
+}
+
+TEST(StanMathRev_reduce_sum, gradient_shared) {
+  stan::math::init_threadpool_tbb();
+
+  const std::size_t elems = 10000;
+  std::vector<int> data(elems);
+  for (std::size_t i = 0; i != elems; ++i) {
+    data[i] = i;
+  }
+  std::vector<int> idata;
+
+  for (int grainsize : {1, 5, 100, 20000}) {
+    stan::math::var lambda_v = 10.0;
+    std::vector<stan::math::var> vlambda_v(1, lambda_v);
+
+    stan::math::var poisson_lpdf = stan::math::reduce_sum<count_lpdf>(
+        data, grainsize, nullptr, vlambda_v, idata);
+
+    stan::math::var lambda_ref = 10.0;
+    stan::math::var poisson_lpdf_ref = stan::math::poisson_lpmf(data,
+                                                                lambda_ref);
+
+    EXPECT_FLOAT_EQ(value_of(poisson_lpdf), value_of(poisson_lpdf_ref));
+
+    stan::math::grad(poisson_lpdf_ref.vi_);
+    const double lambda_ref_adj = lambda_ref.adj();
+
+    stan::math::set_zero_all_adjoints();
+    stan::math::grad(poisson_lpdf.vi_);
+    const double lambda_adj = lambda_v.adj();
+
+    EXPECT_FLOAT_EQ(lambda_adj, lambda_ref_adj)
+        << "ref value of poisson lpdf : " << poisson_lpdf_ref.val()
+        << std::endl
+        << "ref gradient wrt to lambda: " << lambda_ref_adj << std::endl
+        << "value of poisson lpdf : " << poisson_lpdf.val() << std::endl
+        << "gradient wrt to lambda: " << lambda_adj << std::endl;
+
+    stan::math::recover_memory();
+  }
+}
+
+TEST(StanMathRev_reduce_sum, gradient_sliced_and_shared) {
+  using stan::math::var;
+  stan::math::init_threadpool_tbb();
+
+  const std::size_t elems = 1000;
+
+  for (int grainsize : {1, 3, 64, 2000}) {
+    std::vector<var> y(elems);
+    for (std::size_t i = 0; i < elems; ++i) {
+      y[i] = 0.01 * i;
+    }
+    var mu = 0.3;
+    var sigma = 1.7;
+
+    var lp = stan::math::reduce_sum<slice_normal_lpdf>(y, grainsize, nullptr,
+                                                       mu, sigma);
+
+    std::vector<var> y_ref(elems);
+    for (std::size_t i = 0; i < elems; ++i) {
+      y_ref[i] = 0.01 * i;
+    }
+    var mu_ref = 0.3;
+    var sigma_ref = 1.7;
+    var lp_ref = stan::math::normal_lpdf(y_ref, mu_ref, sigma_ref);
+
+    EXPECT_FLOAT_EQ(lp_ref.val(), lp.val());
+
+    std::vector<var> x_ref(y_ref);
+    x_ref.push_back(mu_ref);
+    x_ref.push_back(sigma_ref);
+    std::vector<double> g_ref;
+    lp_ref.grad(x_ref, g_ref);
+    stan::math::set_zero_all_adjoints();
+
+    std::vector<var> x(y);
+    x.push_back(mu);
+    x.push_back(sigma);
+    std::vector<double> g;
+    lp.grad(x, g);
+
+    ASSERT_EQ(g_ref.size(), g.size());
+    for (std::size_t i = 0; i < g.size(); ++i) {
+      EXPECT_FLOAT_EQ(g_ref[i], g[i]);
+    }
+
+    stan::math::recover_memory();
+  }
+}
+
+TEST(StanMathRev_reduce_sum, gradient_containers) {
+  using stan::math::var;
+  using stan::math::vector_v;
+  stan::math::init_threadpool_tbb();
+
+  const std::size_t elems = 50;
+  const int dim = 3;
+
+  std::vector<vector_v> y(elems, vector_v(dim));
+  std::vector<vector_v> y_ref(elems, vector_v(dim));
+  std::vector<var> sigma(elems);
+  std::vector<var> sigma_ref(elems);
+  for (std::size_t i = 0; i < elems; ++i) {
+    for (int j = 0; j < dim; ++j) {
+      y[i](j) = 0.1 * i - j;
+      y_ref[i](j) = 0.1 * i - j;
+    }
+    sigma[i] = 1.0 + 0.05 * i;
+    sigma_ref[i] = 1.0 + 0.05 * i;
+  }
+  vector_v mu(dim);
+  vector_v mu_ref(dim);
+  for (int j = 0; j < dim; ++j) {
+    mu(j) = 0.5 * j;
+    mu_ref(j) = 0.5 * j;
+  }
+
+  var lp = stan::math::reduce_sum_static<nested_slice_lpdf>(y, 7, nullptr, mu,
+                                                            sigma);
+  var lp_ref = nested_slice_lpdf()(y_ref, 0, elems - 1, nullptr, mu_ref,
+                                   sigma_ref);
+
+  EXPECT_FLOAT_EQ(lp_ref.val(), lp.val());
+
+  stan::math::grad(lp_ref.vi_);
+  Eigen::VectorXd mu_ref_adj = mu_ref.adj();
+  Eigen::VectorXd sigma_ref_adj(elems);
+  std::vector<Eigen::VectorXd> y_ref_adj(elems);
+  for (std::size_t i = 0; i < elems; ++i) {
+    sigma_ref_adj(i) = sigma_ref[i].adj();
+    y_ref_adj[i] = y_ref[i].adj();
+  }
+
+  stan::math::set_zero_all_adjoints();
+  stan::math::grad(lp.vi_);
+
+  for (int j = 0; j < dim; ++j) {
+    EXPECT_FLOAT_EQ(mu_ref_adj(j), mu(j).adj());
+  }
+  for (std::size_t i = 0; i < elems; ++i) {
+    EXPECT_FLOAT_EQ(sigma_ref_adj(i), sigma[i].adj());
+    for (int j = 0; j < dim; ++j) {
+      EXPECT_FLOAT_EQ(y_ref_adj[i](j), y[i](j).adj());
+    }
+  }
+
+  stan::math::recover_memory();
+}
+
+TEST(StanMathRev_reduce_sum, empty) {
+  using stan::math::var;
+  stan::math::init_threadpool_tbb();
+
+  std::vector<var> y;
+  var mu = 0.3;
+  var sigma = 1.7;
+
+  var lp
+      = stan::math::reduce_sum<slice_normal_lpdf>(y, 1, nullptr, mu, sigma);
+  EXPECT_FLOAT_EQ(0.0, lp.val());
+
+  stan::math::recover_memory();
+}
+
+TEST(StanMathRev_reduce_sum, count_vars_save_varis) {
+  using stan::math::var;
+  using stan::math::vector_v;
+
+  var a = 1.0;
+  std::vector<var> b(3, var(2.0));
+  vector_v c(2);
+  c << 3.0, 4.0;
+  std::vector<vector_v> d(2, c);
+  std::vector<double> e(4, 1.0);
+  int f = 2;
+
+  EXPECT_EQ(0, stan::math::count_vars(e, f));
+  EXPECT_EQ(10, stan::math::count_vars(a, b, c, d, e, f));
+
+  std::vector<stan::math::vari*> varis(10);
+  stan::math::vari** end
+      = stan::math::save_varis(varis.data(), a, e, b, c, f, d);
+  EXPECT_EQ(varis.data() + 10, end);
+  EXPECT_EQ(a.vi_, varis[0]);
+  EXPECT_EQ(b[2].vi_, varis[3]);
+  EXPECT_EQ(c(1).vi_, varis[5]);
+  EXPECT_EQ(d[1](1).vi_, varis[9]);
+
+  std::vector<double> adjs(10, 1.0);
+  a.vi_->adj_ = 2.0;
+  d[1](1).vi_->adj_ = 3.0;
+  stan::math::accumulate_adjoints(adjs.data(), a, b, f, c, d);
+  EXPECT_FLOAT_EQ(3.0, adjs[0]);
+  EXPECT_FLOAT_EQ(1.0, adjs[1]);
+  EXPECT_FLOAT_EQ(4.0, adjs[9]);
+
+  std::vector<vector_v> d_copy = stan::math::deep_copy_vars(d);
+  EXPECT_NE(d[0](0).vi_, d_copy[0](0).vi_);
+  EXPECT_FLOAT_EQ(d[0](0).val(), d_copy[0](0).val());
+  EXPECT_FLOAT_EQ(0.0, d_copy[1](1).adj());
+
+  stan::math::recover_memory();
+}
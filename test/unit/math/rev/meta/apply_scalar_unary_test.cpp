@@ -0,0 +1,110 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/math/rev/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+/**
+ * Check that the values and gradients of f applied to a vector of var
+ * and to a matrix of var match those of f applied to each element.
+ */
+template <typename F>
+void expect_container_grad(const F& f, const Eigen::VectorXd& x_d) {
+  using stan::math::var;
+  using stan::math::vector_v;
+  const int N = x_d.size();
+
+  std::vector<double> vals;
+  std::vector<double> grads;
+  for (int i = 0; i < N; ++i) {
+    var x = x_d(i);
+    var fx = f(x);
+    fx.grad();
+    vals.push_back(fx.val());
+    grads.push_back((i + 1) * x.adj());
+    stan::math::recover_memory();
+  }
+
+  std::vector<var> x_std(x_d.data(), x_d.data() + N);
+  std::vector<var> fx_std = f(x_std);
+  test::check_varis_on_stack(fx_std);
+  var lp = 0;
+  for (int i = 0; i < N; ++i) {
+    lp += (i + 1) * fx_std[i];
+  }
+  lp.grad();
+  for (int i = 0; i < N; ++i) {
+    EXPECT_FLOAT_EQ(vals[i], fx_std[i].val());
+    EXPECT_FLOAT_EQ(grads[i], x_std[i].adj());
+  }
+  stan::math::recover_memory();
+
+  vector_v x_vec = x_d;
+  vector_v fx_vec = f(x_vec);
+  test::check_varis_on_stack(fx_vec);
+  lp = 0;
+  for (int i = 0; i < N; ++i) {
+    lp += (i + 1) * fx_vec(i);
+  }
+  lp.grad();
+  for (int i = 0; i < N; ++i) {
+    EXPECT_FLOAT_EQ(vals[i], fx_vec(i).val());
+    EXPECT_FLOAT_EQ(grads[i], x_vec(i).adj());
+  }
+  stan::math::recover_memory();
+}
+}  // namespace
+
+TEST(AgradRevApplyScalarUnary, vectorized_gradients) {
+  Eigen::VectorXd x(5);
+  x << 0.1, 0.7, 1.3, 2.5, 8.0;
+  Eigen::VectorXd y(5);
+  y << -30.0, -1.5, 0.0, 2.0, 40.0;
+
+  expect_container_grad([](const auto& v) { return stan::math::exp(v); }, y);
+  expect_container_grad([](const auto& v) { return stan::math::log(v); }, x);
+  expect_container_grad([](const auto& v) { return stan::math::log1p(v); },
+                        x);
+  expect_container_grad([](const auto& v) { return stan::math::expm1(v); },
+                        y);
+  expect_container_grad([](const auto& v) { return stan::math::sqrt(v); }, x);
+  expect_container_grad(
+      [](const auto& v) { return stan::math::inv_logit(v); }, y);
+  expect_container_grad(
+      [](const auto& v) { return stan::math::log1p_exp(v); }, y);
+  expect_container_grad([](const auto& v) { return stan::math::lgamma(v); },
+                        x);
+  // functions without a vectorized derivative create a vari per element
+  expect_container_grad([](const auto& v) { return stan::math::cos(v); }, y);
+}
+
+TEST(AgradRevApplyScalarUnary, single_vari) {
+  using stan::math::var;
+  using stan::math::vector_v;
+  vector_v x = Eigen::VectorXd::LinSpaced(100, 0.5, 10.0);
+  const size_t n_chain
+      = stan::math::ChainableStack::instance_->var_stack_.size();
+  vector_v fx = stan::math::exp(x);
+  EXPECT_EQ(n_chain + 1,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+
+  std::vector<std::vector<var>> x_nested(3, std::vector<var>(4, 1.5));
+  std::vector<std::vector<var>> fx_nested = stan::math::log(x_nested);
+  EXPECT_EQ(n_chain + 4,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+  fx_nested[1][2].grad();
+  EXPECT_FLOAT_EQ(1 / 1.5, x_nested[1][2].adj());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevApplyScalarUnary, empty_and_errors) {
+  using stan::math::var;
+  using stan::math::vector_v;
+  EXPECT_EQ(0, stan::math::exp(vector_v()).size());
+  EXPECT_EQ(0, stan::math::log(std::vector<var>()).size());
+
+  vector_v x(3);
+  x << 0.5, -2.0, 1.0;
+  EXPECT_THROW(stan::math::log1p(x), std::domain_error);
+  stan::math::recover_memory();
+}
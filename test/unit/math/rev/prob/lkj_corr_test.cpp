@@ -98,3 +98,35 @@ TEST(ProbDistributionsLkjCorrCholesky, gradients) {
   test_grad_eq(grad_1, grad_ad_1);
   EXPECT_FLOAT_EQ(fx, fx_ad);
 }
+
+TEST(ProbDistributionsLkjCorr, gradient) {
+  using stan::math::var;
+  const int K = 3;
+  Eigen::MatrixXd y_d(K, K);
+  y_d << 1, 0.5, 0.2, 0.5, 1, -0.3, 0.2, -0.3, 1;
+  const double eta = 2.5;
+
+  Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic> y = y_d;
+  var lp = stan::math::lkj_corr_lpdf(y, eta);
+  lp.grad();
+
+  // d/dy (eta - 1) log det(y) = (eta - 1) inverse(y), where the
+  // partials of mirrored elements of the symmetric y are summed
+  const Eigen::MatrixXd expected = (eta - 1) * y_d.inverse();
+  EXPECT_FLOAT_EQ(stan::math::lkj_corr_lpdf(y_d, eta), lp.val());
+  for (int j = 0; j < K; ++j) {
+    for (int i = j; i < K; ++i) {
+      const double adj
+          = i == j ? y(i, i).adj() : y(i, j).adj() + y(j, i).adj();
+      const double adj_expected
+          = i == j ? expected(i, i) : expected(i, j) + expected(j, i);
+      EXPECT_FLOAT_EQ(adj_expected, adj);
+    }
+  }
+  stan::math::recover_memory();
+
+  y_d(0, 1) = 0.6;
+  y = y_d;
+  EXPECT_THROW(stan::math::lkj_corr_lpdf(y, eta), std::domain_error);
+  stan::math::recover_memory();
+}
@@ -0,0 +1,102 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/math/rev/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using std::vector;
+
+TEST(ProbDistributionsMultiNormal, check_varis_on_stack) {
+  using stan::math::to_var;
+  Matrix<double, Dynamic, 1> y(3, 1);
+  y << 2.0, -2.0, 11.0;
+  Matrix<double, Dynamic, 1> mu(3, 1);
+  mu << 1.0, -1.0, 3.0;
+  Matrix<double, Dynamic, Dynamic> Sigma(3, 3);
+  Sigma << 9.0, -3.0, 0.0, -3.0, 4.0, 0.0, 0.0, 0.0, 5.0;
+  test::check_varis_on_stack(stan::math::multi_normal_lpdf<true>(
+      to_var(y), to_var(mu), to_var(Sigma)));
+  test::check_varis_on_stack(
+      stan::math::multi_normal_lpdf<true>(to_var(y), mu, to_var(Sigma)));
+  test::check_varis_on_stack(
+      stan::math::multi_normal_lpdf<true>(y, to_var(mu), Sigma));
+  test::check_varis_on_stack(
+      stan::math::multi_normal_lpdf<true>(y, mu, to_var(Sigma)));
+  test::check_varis_on_stack(stan::math::multi_normal_lpdf<false>(
+      to_var(y), to_var(mu), to_var(Sigma)));
+  test::check_varis_on_stack(
+      stan::math::multi_normal_lpdf<false>(to_var(y), mu, Sigma));
+  test::check_varis_on_stack(
+      stan::math::multi_normal_lpdf<false>(y, mu, to_var(Sigma)));
+}
+
+TEST(ProbDistributionsMultiNormal, gradient_many_observations) {
+  using stan::math::var;
+  using stan::math::vector_d;
+  using stan::math::vector_v;
+  const int K = 3;
+  const int N = 50;
+
+  Matrix<double, Dynamic, Dynamic> Sigma_d(K, K);
+  Sigma_d << 9.0, -3.0, 0.5, -3.0, 4.0, 0.2, 0.5, 0.2, 5.0;
+  vector_d mu_d(K);
+  mu_d << 1.0, -1.0, 3.0;
+  vector<vector_d> y_d(N, vector_d(K));
+  for (int n = 0; n < N; ++n) {
+    for (int k = 0; k < K; ++k) {
+      y_d[n](k) = std::sin(n + 3.0 * k) * (k + 1);
+    }
+  }
+
+  // reference: the log density of each observation through the
+  // Cholesky factor of Sigma
+  vector<vector_v> y_ref;
+  for (const auto& y_n : y_d) {
+    y_ref.emplace_back(y_n);
+  }
+  vector_v mu_ref = mu_d;
+  Matrix<var, Dynamic, Dynamic> Sigma_ref = Sigma_d;
+  var lp_ref = 0;
+  Matrix<var, Dynamic, Dynamic> L_ref
+      = stan::math::cholesky_decompose(Sigma_ref);
+  for (int n = 0; n < N; ++n) {
+    lp_ref += stan::math::multi_normal_cholesky_lpdf(y_ref[n], mu_ref, L_ref);
+  }
+  lp_ref.grad();
+  const double lp_ref_val = lp_ref.val();
+  const vector_d mu_ref_adj = mu_ref.adj();
+  const Matrix<double, Dynamic, Dynamic> Sigma_ref_adj = Sigma_ref.adj();
+  vector<vector_d> y_ref_adj;
+  for (const auto& y_n : y_ref) {
+    y_ref_adj.push_back(y_n.adj());
+  }
+  stan::math::recover_memory();
+
+  vector<vector_v> y;
+  for (const auto& y_n : y_d) {
+    y.emplace_back(y_n);
+  }
+  vector_v mu = mu_d;
+  Matrix<var, Dynamic, Dynamic> Sigma = Sigma_d;
+  var lp = stan::math::multi_normal_lpdf(y, mu, Sigma);
+  lp.grad();
+
+  EXPECT_FLOAT_EQ(lp_ref_val, lp.val());
+  for (int k = 0; k < K; ++k) {
+    EXPECT_FLOAT_EQ(mu_ref_adj(k), mu(k).adj());
+    for (int n = 0; n < N; ++n) {
+      EXPECT_FLOAT_EQ(y_ref_adj[n](k), y[n](k).adj());
+    }
+    // Sigma is symmetric, so only the sums of the partials of mirrored
+    // elements are comparable
+    for (int j = 0; j <= k; ++j) {
+      const double adj_ref = j == k ? Sigma_ref_adj(k, k)
+                                    : Sigma_ref_adj(k, j) + Sigma_ref_adj(j, k);
+      const double adj = j == k ? Sigma(k, k).adj()
+                                : Sigma(k, j).adj() + Sigma(j, k).adj();
+      EXPECT_FLOAT_EQ(adj_ref, adj);
+    }
+  }
+  stan::math::recover_memory();
+}
@@ -556,3 +556,80 @@ TEST(ProbDistributionsNegBinomial2LogGLM,
       stan::math::neg_binomial_2_log_glm_lpmf(y, x, alpha, beta, sigmaw3),
       std::domain_error);
 }
+
+//  We check that a sparse matrix of independent variables gives the same
+//  values and gradients as the equivalent dense one.
+TEST(ProbDistributionsNegBinomial2LogGLM, glm_sparse_x_matches_dense_x) {
+  vector<int> y{3, 0, 1, 7, 2};
+  Matrix<double, Dynamic, Dynamic> x(5, 4);
+  x << 1.2, 0, 0, 0, 0, -0.4, 0, 0.8, 0, 0, 0, 0, 0.3, 0, 1.1, 0, 0, 0, 0,
+      -2.1;
+  Eigen::SparseMatrix<double> x_sparse = x.sparseView();
+  Matrix<double, Dynamic, 1> beta_dbl(4);
+  beta_dbl << 0.3, -0.7, 0.2, 0.5;
+  double alpha_dbl = 0.6;
+  double phi_dbl = 2.5;
+  Matrix<var, Dynamic, 1> beta = beta_dbl;
+  var alpha = alpha_dbl;
+  var phi = phi_dbl;
+  var lp = stan::math::neg_binomial_2_log_glm_lpmf(y, x, alpha, beta, phi);
+  lp.grad();
+  double lp_val = lp.val();
+  double alpha_adj = alpha.adj();
+  Matrix<double, Dynamic, 1> beta_adj(4);
+  for (size_t i = 0; i < 4; i++) {
+    beta_adj[i] = beta[i].adj();
+  }
+  double phi_adj = phi.adj();
+  stan::math::recover_memory();
+
+  beta = beta_dbl;
+  alpha = alpha_dbl;
+  phi = phi_dbl;
+  var lp_sparse
+      = stan::math::neg_binomial_2_log_glm_lpmf(y, x_sparse, alpha, beta, phi);
+  lp_sparse.grad();
+  EXPECT_FLOAT_EQ(lp_val, lp_sparse.val());
+  EXPECT_FLOAT_EQ(alpha_adj, alpha.adj());
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_FLOAT_EQ(beta_adj[i], beta[i].adj());
+  }
+  EXPECT_FLOAT_EQ(phi_adj, phi.adj());
+  var lp_propto
+      = stan::math::neg_binomial_2_log_glm_lpmf<true>(y, x, alpha, beta, phi);
+  var lp_sparse_propto = stan::math::neg_binomial_2_log_glm_lpmf<true>(
+      y, x_sparse, alpha, beta, phi);
+  EXPECT_FLOAT_EQ(lp_propto.val(), lp_sparse_propto.val());
+}
+
+//  We check that precomputed GLM data gives the same values and gradients as
+//  the dependent and independent variables it holds.
+TEST(ProbDistributionsNegBinomial2LogGLM, glm_data_matches_y_x) {
+  vector<int> y{3, 0, 1, 7, 2};
+  Matrix<double, Dynamic, Dynamic> x(5, 2);
+  x << 1.2, -0.3, 0.4, 0.8, -1.1, 0.5, 0.2, 0.1, 0.7, -0.9;
+  stan::math::glm_data<vector<int>, Matrix<double, Dynamic, Dynamic>> data(
+      y, x);
+  Matrix<var, Dynamic, 1> beta(2);
+  beta << 0.3, -0.7;
+  var alpha = 0.6;
+  var phi = 2.5;
+  var lp = stan::math::neg_binomial_2_log_glm_lpmf(y, x, alpha, beta, phi);
+  var lp_data = stan::math::neg_binomial_2_log_glm_lpmf(data, alpha, beta, phi);
+  EXPECT_FLOAT_EQ(lp.val(), lp_data.val());
+  var lp_propto
+      = stan::math::neg_binomial_2_log_glm_lpmf<true>(y, x, alpha, beta, phi);
+  var lp_data_propto
+      = stan::math::neg_binomial_2_log_glm_lpmf<true>(data, alpha, beta, phi);
+  EXPECT_FLOAT_EQ(lp_propto.val(), lp_data_propto.val());
+
+  std::vector<var> vars{alpha, beta[0], beta[1], phi};
+  std::vector<double> grad;
+  lp.grad(vars, grad);
+  stan::math::set_zero_all_adjoints();
+  std::vector<double> grad_data;
+  lp_data.grad(vars, grad_data);
+  for (size_t i = 0; i < vars.size(); i++) {
+    EXPECT_FLOAT_EQ(grad[i], grad_data[i]);
+  }
+}
@@ -646,3 +646,49 @@ TEST(ProbDistributionsNormalIdGLM, glm_matches_normal_id_error_checking) {
   EXPECT_THROW(stan::math::normal_id_glm_lpdf(y, x, alpha, beta, sigmaw3),
                std::domain_error);
 }
+
+//  We check that a sparse matrix of independent variables gives the same
+//  values and gradients as the equivalent dense one.
+TEST(ProbDistributionsNormalIdGLM, glm_sparse_x_matches_dense_x) {
+  Matrix<double, Dynamic, 1> y(5);
+  y << 0.4, -1.3, 2.2, 0.1, -0.5;
+  Matrix<double, Dynamic, Dynamic> x(5, 4);
+  x << 1.2, 0, 0, 0, 0, -0.4, 0, 0.8, 0, 0, 0, 0, 0.3, 0, 1.1, 0, 0, 0, 0,
+      -2.1;
+  Eigen::SparseMatrix<double> x_sparse = x.sparseView();
+  Matrix<double, Dynamic, 1> beta_dbl(4);
+  beta_dbl << 0.3, -0.7, 0.2, 0.5;
+  double alpha_dbl = 0.6;
+  double sigma_dbl = 1.7;
+  Matrix<var, Dynamic, 1> beta = beta_dbl;
+  var alpha = alpha_dbl;
+  var sigma = sigma_dbl;
+  var lp = stan::math::normal_id_glm_lpdf(y, x, alpha, beta, sigma);
+  lp.grad();
+  double lp_val = lp.val();
+  double alpha_adj = alpha.adj();
+  Matrix<double, Dynamic, 1> beta_adj(4);
+  for (size_t i = 0; i < 4; i++) {
+    beta_adj[i] = beta[i].adj();
+  }
+  double sigma_adj = sigma.adj();
+  stan::math::recover_memory();
+
+  beta = beta_dbl;
+  alpha = alpha_dbl;
+  sigma = sigma_dbl;
+  var lp_sparse
+      = stan::math::normal_id_glm_lpdf(y, x_sparse, alpha, beta, sigma);
+  lp_sparse.grad();
+  EXPECT_FLOAT_EQ(lp_val, lp_sparse.val());
+  EXPECT_FLOAT_EQ(alpha_adj, alpha.adj());
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_FLOAT_EQ(beta_adj[i], beta[i].adj());
+  }
+  EXPECT_FLOAT_EQ(sigma_adj, sigma.adj());
+  var lp_propto
+      = stan::math::normal_id_glm_lpdf<true>(y, x, alpha, beta, sigma);
+  var lp_sparse_propto
+      = stan::math::normal_id_glm_lpdf<true>(y, x_sparse, alpha, beta, sigma);
+  EXPECT_FLOAT_EQ(lp_propto.val(), lp_sparse_propto.val());
+}
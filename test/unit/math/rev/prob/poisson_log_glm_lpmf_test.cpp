@@ -490,3 +490,75 @@ TEST(ProbDistributionsPoissonLogGLM, glm_matches_poisson_log_vars_propto) {
   double lp1_val = lp1.val();
   EXPECT_FLOAT_EQ(lp_val, lp1_val);
 }
+
+//  We check that a sparse matrix of independent variables gives the same
+//  values and gradients as the equivalent dense one.
+TEST(ProbDistributionsPoissonLogGLM, glm_sparse_x_matches_dense_x) {
+  vector<int> y{3, 0, 1, 7, 2};
+  Matrix<double, Dynamic, Dynamic> x(5, 4);
+  x << 1.2, 0, 0, 0, 0, -0.4, 0, 0.8, 0, 0, 0, 0, 0.3, 0, 1.1, 0, 0, 0, 0,
+      -2.1;
+  Eigen::SparseMatrix<double> x_sparse = x.sparseView();
+  Matrix<double, Dynamic, 1> beta_dbl(4);
+  beta_dbl << 0.3, -0.7, 0.2, 0.5;
+  double alpha_dbl = 0.6;
+  Matrix<var, Dynamic, 1> beta = beta_dbl;
+  var alpha = alpha_dbl;
+
+  var lp = stan::math::poisson_log_glm_lpmf(y, x, alpha, beta);
+  lp.grad();
+  double lp_val = lp.val();
+  double alpha_adj = alpha.adj();
+  Matrix<double, Dynamic, 1> beta_adj(4);
+  for (size_t i = 0; i < 4; i++) {
+    beta_adj[i] = beta[i].adj();
+  }
+
+  stan::math::recover_memory();
+
+  beta = beta_dbl;
+  alpha = alpha_dbl;
+
+  var lp_sparse = stan::math::poisson_log_glm_lpmf(y, x_sparse, alpha, beta);
+  lp_sparse.grad();
+  EXPECT_FLOAT_EQ(lp_val, lp_sparse.val());
+  EXPECT_FLOAT_EQ(alpha_adj, alpha.adj());
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_FLOAT_EQ(beta_adj[i], beta[i].adj());
+  }
+
+  var lp_propto = stan::math::poisson_log_glm_lpmf<true>(y, x, alpha, beta);
+  var lp_sparse_propto
+      = stan::math::poisson_log_glm_lpmf<true>(y, x_sparse, alpha, beta);
+  EXPECT_FLOAT_EQ(lp_propto.val(), lp_sparse_propto.val());
+}
+
+//  We check that precomputed GLM data gives the same values and gradients as
+//  the dependent and independent variables it holds.
+TEST(ProbDistributionsPoissonLogGLM, glm_data_matches_y_x) {
+  vector<int> y{3, 0, 1, 7, 2};
+  Matrix<double, Dynamic, Dynamic> x(5, 2);
+  x << 1.2, -0.3, 0.4, 0.8, -1.1, 0.5, 0.2, 0.1, 0.7, -0.9;
+  stan::math::glm_data<vector<int>, Matrix<double, Dynamic, Dynamic>> data(
+      y, x);
+  Matrix<var, Dynamic, 1> beta(2);
+  beta << 0.3, -0.7;
+  var alpha = 0.6;
+  var lp = stan::math::poisson_log_glm_lpmf(y, x, alpha, beta);
+  var lp_data = stan::math::poisson_log_glm_lpmf(data, alpha, beta);
+  EXPECT_FLOAT_EQ(lp.val(), lp_data.val());
+  var lp_propto = stan::math::poisson_log_glm_lpmf<true>(y, x, alpha, beta);
+  var lp_data_propto
+      = stan::math::poisson_log_glm_lpmf<true>(data, alpha, beta);
+  EXPECT_FLOAT_EQ(lp_propto.val(), lp_data_propto.val());
+
+  std::vector<var> vars{alpha, beta[0], beta[1]};
+  std::vector<double> grad;
+  lp.grad(vars, grad);
+  stan::math::set_zero_all_adjoints();
+  std::vector<double> grad_data;
+  lp_data.grad(vars, grad_data);
+  for (size_t i = 0; i < vars.size(); i++) {
+    EXPECT_FLOAT_EQ(grad[i], grad_data[i]);
+  }
+}